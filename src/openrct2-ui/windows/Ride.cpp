@@ -5476,7 +5476,7 @@ static void WindowRideMeasurementsTooldown(rct_window* w, rct_widgetindex widget
         case ViewportInteractionItem::LargeScenery:
         case ViewportInteractionItem::Wall:
         case ViewportInteractionItem::Footpath:
-            _collectTrackDesignScenery = !track_design_save_contains_tile_element(info.Element);
+            _collectTrackDesignScenery = !track_design_save_contains_tile_element(info.Loc, info.Element);
             track_design_save_select_tile_element(info.SpriteType, info.Loc, info.Element, _collectTrackDesignScenery);
             break;
         default:
@@ -565,14 +565,14 @@ static void WindowTileInspectorSelectElementFromList(rct_window* w, int32_t inde
     if (index < 0 || index >= windowTileInspectorElementCount)
     {
         windowTileInspectorSelectedIndex = -1;
-        OpenRCT2::TileInspector::SetSelectedElement(nullptr);
+        OpenRCT2::TileInspector::SetSelectedElement(windowTileInspectorToolMap, nullptr);
     }
     else
     {
         windowTileInspectorSelectedIndex = index;
 
         const TileElement* const tileElement = WindowTileInspectorGetSelectedElement(w);
-        OpenRCT2::TileInspector::SetSelectedElement(tileElement);
+        OpenRCT2::TileInspector::SetSelectedElement(windowTileInspectorToolMap, tileElement);
     }
 
     w->Invalidate();
@@ -784,7 +784,7 @@ static void WindowTileInspectorToggleInvisibility(int32_t elementIndex)
 
 static void WindowTileInspectorClose(rct_window* w)
 {
-    OpenRCT2::TileInspector::SetSelectedElement(nullptr);
+    OpenRCT2::TileInspector::SetSelectedElement(windowTileInspectorToolMap, nullptr);
 }
 
 static void WindowTileInspectorMouseup(rct_window* w, rct_widgetindex widgetIndex)
@@ -831,7 +831,7 @@ static void WindowTileInspectorMouseup(rct_window* w, rct_widgetindex widgetInde
     TileElement* const tileElement = WindowTileInspectorGetSelectedElement(w);
 
     // Update selection, can be nullptr.
-    OpenRCT2::TileInspector::SetSelectedElement(tileElement);
+    OpenRCT2::TileInspector::SetSelectedElement(windowTileInspectorToolMap, tileElement);
 
     if (tileElement == nullptr)
         return;
@@ -1294,7 +1294,7 @@ static void WindowTileInspectorUpdateSelectedTile(rct_window* w, const ScreenCoo
     windowTileInspectorToolMap = mapCoords;
     windowTileInspectorTile = TileCoordsXY(mapCoords);
 
-    OpenRCT2::TileInspector::SetSelectedElement(clickedElement);
+    OpenRCT2::TileInspector::SetSelectedElement(mapCoords, clickedElement);
 
     WindowTileInspectorLoadTile(w, clickedElement);
 }
@@ -175,6 +175,7 @@ namespace OpenRCT2
             //       If objects use GetContext() in their destructor things won't go well.
 
             GameActions::ClearQueue();
+            game_autosave_wait();
 #ifndef DISABLE_NETWORK
             _network.Close();
 #endif
@@ -23,6 +23,7 @@
 #include "audio/audio.h"
 #include "config/Config.h"
 #include "core/Console.hpp"
+#include "core/JobPool.h"
 #include "core/File.h"
 #include "core/FileScanner.h"
 #include "core/Path.hpp"
@@ -663,16 +664,28 @@ static void limit_autosave_count(const size_t numberOfFilesToKeep, bool processL
     }
 }
 
+static std::unique_ptr<JobPool> _autosaveJobs;
+
+void game_autosave_wait()
+{
+    if (_autosaveJobs != nullptr)
+    {
+        _autosaveJobs->Join();
+    }
+}
+
+/**
+ * Only serialising the park happens on the game thread, compressing and writing the file as well as removing old
+ * autosaves are done in the background.
+ */
 void game_autosave()
 {
     const char* subDirectory = "save";
     const char* fileExtension = ".park";
-    uint32_t saveFlags = 0x80000000;
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
     {
         subDirectory = "landscape";
         fileExtension = ".sc6";
-        saveFlags |= 2;
     }
 
     // Retrieve current time
@@ -684,8 +697,8 @@ void game_autosave()
         timeName, sizeof(timeName), "autosave_%04u-%02u-%02u_%02u-%02u-%02u%s", currentDate.year, currentDate.month,
         currentDate.day, currentTime.hour, currentTime.minute, currentTime.second, fileExtension);
 
-    int32_t autosavesToKeep = gConfigGeneral.autosave_amount;
-    limit_autosave_count(autosavesToKeep - 1, (gScreenFlags & SCREEN_FLAGS_EDITOR));
+    const size_t numberOfFilesToKeep = gConfigGeneral.autosave_amount - 1;
+    const bool processLandscapeFolder = (gScreenFlags & SCREEN_FLAGS_EDITOR) != 0;
 
     utf8 path[MAX_PATH];
     utf8 backupPath[MAX_PATH];
@@ -698,13 +711,26 @@ void game_autosave()
     safe_strcat(backupPath, fileExtension, sizeof(backupPath));
     safe_strcat(backupPath, ".bak", sizeof(backupPath));
 
-    if (File::Exists(path))
+    // Only one autosave is written at a time.
+    game_autosave_wait();
+
+    auto writeSave = scenario_save_deferred(path);
+    if (_autosaveJobs == nullptr)
     {
-        File::Copy(path, backupPath, true);
+        _autosaveJobs = std::make_unique<JobPool>();
     }
+    _autosaveJobs->AddTask([writeSave = std::move(writeSave), numberOfFilesToKeep, processLandscapeFolder,
+                            path = std::string(path), backupPath = std::string(backupPath)]() {
+        limit_autosave_count(numberOfFilesToKeep, processLandscapeFolder);
+
+        if (File::Exists(path))
+        {
+            File::Copy(path, backupPath, true);
+        }
 
-    if (!scenario_save(path, saveFlags))
-        Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+        if (!writeSave())
+            Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+    });
 }
 
 static void game_load_or_quit_no_save_prompt_callback(int32_t result, const utf8* path)
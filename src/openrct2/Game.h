@@ -168,6 +168,7 @@ void save_game_as();
 void save_game_cmd(const utf8* name = nullptr);
 void save_game_with_name(const utf8* name);
 void game_autosave();
+void game_autosave_wait();
 void rct2_to_utf8_self(char* buffer, size_t length);
 void game_fix_save_vars();
 void start_silent_record();
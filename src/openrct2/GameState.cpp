@@ -307,6 +307,7 @@ void GameState::UpdateLogic(LogicTimings* timings)
     report_time(LogicTimePart::Scenario);
     climate_update();
     report_time(LogicTimePart::Climate);
+    MapCompactTileElements();
     map_update_tiles();
     report_time(LogicTimePart::MapTiles);
     // Temporarily remove provisional paths to prevent peep from interacting with them
@@ -18,7 +18,9 @@
 #include "../localisation/Formatter.h"
 #include "../localisation/Localisation.h"
 #include "../network/network.h"
+#include "../peep/GuestPathfinding.h"
 #include "../platform/platform.h"
+#include "../ride/RideCandidateIndex.h"
 #include "../scenario/Scenario.h"
 #include "../scripting/Duktape.hpp"
 #include "../scripting/HookEngine.h"
@@ -284,6 +286,64 @@ namespace GameActions
         network_append_server_log(text);
     }
 
+    /**
+     * Returns whether the action can change the footpath network the pathfinding graph is built from or the ride types the
+     * search reads, this includes the actions that only run other actions so the graph is dropped even if a nested action
+     * partly failed.
+     */
+    static bool ChangesFootpathNetwork(const GameAction* action)
+    {
+        switch (action->GetType())
+        {
+            case GameCommand::PlacePath:
+            case GameCommand::PlacePathFromTrack:
+            case GameCommand::RemovePath:
+            case GameCommand::PlaceBanner:
+            case GameCommand::RemoveBanner:
+            case GameCommand::SetBannerStyle:
+            case GameCommand::PlaceRideEntranceOrExit:
+            case GameCommand::RemoveRideEntranceOrExit:
+            case GameCommand::PlaceParkEntrance:
+            case GameCommand::RemoveParkEntrance:
+            case GameCommand::PlaceTrack:
+            case GameCommand::RemoveTrack:
+            case GameCommand::SetMazeTrack:
+            case GameCommand::PlaceTrackDesign:
+            case GameCommand::PlaceMazeDesign:
+            case GameCommand::CreateRide:
+            case GameCommand::DemolishRide:
+            // The search treats track of shops differently, so changing a ride's type changes the directions chosen.
+            case GameCommand::SetRideSetting:
+            case GameCommand::ClearScenery:
+            case GameCommand::ModifyTile:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Returns whether the action only changes the footpath network on the tile of its result position and the edges of
+     * the paths next to it.
+     */
+    static bool ChangesFootpathNetworkAtPosition(const GameAction* action)
+    {
+        switch (action->GetType())
+        {
+            case GameCommand::PlacePath:
+            case GameCommand::PlacePathFromTrack:
+            case GameCommand::RemovePath:
+            case GameCommand::PlaceBanner:
+            case GameCommand::RemoveBanner:
+            case GameCommand::SetBannerStyle:
+            case GameCommand::PlaceRideEntranceOrExit:
+            case GameCommand::RemoveRideEntranceOrExit:
+                return true;
+            default:
+                return false;
+        }
+    }
+
     static GameActions::Result ExecuteInternal(const GameAction* action, bool topLevel)
     {
         Guard::ArgumentNotNull(action);
@@ -352,6 +412,22 @@ namespace GameActions
 
             // Execute the action, changing the game state
             result = action->Execute();
+            if (result.Error == GameActions::Status::Ok)
+            {
+                RideCandidateIndex::Invalidate();
+            }
+            // Ghosts are not part of the footpath network, the paths they connect to are dropped by the edge updates.
+            if (ChangesFootpathNetwork(action) && !(action->GetFlags() & GAME_COMMAND_FLAG_GHOST))
+            {
+                if (ChangesFootpathNetworkAtPosition(action) && !result.Position.IsNull())
+                {
+                    FootpathGraph::InvalidateTile(result.Position);
+                }
+                else
+                {
+                    FootpathGraph::Invalidate();
+                }
+            }
 #ifdef ENABLE_SCRIPTING
             if (result.Error == GameActions::Status::Ok)
             {
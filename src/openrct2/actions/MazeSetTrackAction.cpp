@@ -294,7 +294,7 @@ GameActions::Result MazeSetTrackAction::Execute() const
 
     if ((tileElement->AsTrack()->GetMazeEntry() & 0x8888) == 0x8888)
     {
-        tile_element_remove(tileElement);
+        tile_element_remove(_loc, tileElement);
         ride->ValidateStations();
         ride->maze_tiles--;
     }
@@ -222,7 +222,7 @@ money32 RideDemolishAction::DemolishTracks() const
                         itemRemoved = true;
                         if (removRes.Error != GameActions::Status::Ok)
                         {
-                            tile_element_remove(trackElement->as<TileElement>());
+                            tile_element_remove(location, trackElement->as<TileElement>());
                         }
                         else
                         {
@@ -12,11 +12,16 @@
 #ifdef USE_BENCHMARK
 
 #    include "../Context.h"
+#    include "../Game.h"
 #    include "../GameState.h"
 #    include "../OpenRCT2.h"
 #    include "../core/File.h"
+#    include "../entity/EntityList.h"
+#    include "../entity/Peep.h"
+#    include "../peep/GuestPathfinding.h"
 #    include "../platform/Platform2.h"
 #    include "../platform/platform.h"
+#    include "../ride/RideRatings.h"
 
 #    include <benchmark/benchmark.h>
 #    include <cstdint>
@@ -36,6 +41,7 @@ static void BM_update(benchmark::State& state, const std::string& filename)
             state.SkipWithError("Failed to load file!");
         }
 
+        const auto pathfindCacheStart = FootpathGraph::GetDirectionCacheStats();
         std::vector<LogicTimings> timings(1);
         timings.reserve(100);
         int currentTimingIdx = 0;
@@ -81,6 +87,59 @@ static void BM_update(benchmark::State& state, const std::string& filename)
         state.counters["GameActionsAcc_ms"] = accumulator(LogicTimePart::GameActions);
         state.counters["NetworkFlushAcc_ms"] = accumulator(LogicTimePart::NetworkFlush);
         state.counters["ScriptsAcc_ms"] = accumulator(LogicTimePart::Scripts);
+
+        const auto pathfindCacheEnd = FootpathGraph::GetDirectionCacheStats();
+        state.counters["PathfindCacheHits"] = static_cast<double>(pathfindCacheEnd.Hits - pathfindCacheStart.Hits);
+        state.counters["PathfindCacheMisses"] = static_cast<double>(pathfindCacheEnd.Misses - pathfindCacheStart.Misses);
+    }
+    else
+    {
+        state.SkipWithError("Context initialization failed.");
+    }
+}
+
+static void BM_ratings(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (context->Initialise())
+    {
+        if (!context->LoadParkFromFile(filename))
+        {
+            state.SkipWithError("Failed to load file!");
+        }
+
+        size_t numRides = 0;
+        for (auto _ : state)
+        {
+            numRides += ride_ratings_update_all_instant().size();
+        }
+        state.SetItemsProcessed(numRides);
+    }
+    else
+    {
+        state.SkipWithError("Context initialization failed.");
+    }
+}
+
+static void BM_guests(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (context->Initialise())
+    {
+        if (!context->LoadParkFromFile(filename))
+        {
+            state.SkipWithError("Failed to load file!");
+        }
+
+        // Only the guest and staff update, the tick is advanced so every guest gets its 128 tick update in turn.
+        size_t numGuests = 0;
+        for (auto _ : state)
+        {
+            numGuests += GetEntityListCount(EntityType::Guest);
+            peep_update_all();
+            gCurrentTicks++;
+        }
+        state.SetItemsProcessed(numGuests);
     }
     else
     {
@@ -107,6 +166,8 @@ static int CmdlineForBenchSpriteSort(int argc, const char* const* argv)
         {
             // Register benchmark for sv6 if valid
             benchmark::RegisterBenchmark(argv[i], BM_update, argv[i]);
+            benchmark::RegisterBenchmark((std::string(argv[i]) + "/ratings").c_str(), BM_ratings, argv[i]);
+            benchmark::RegisterBenchmark((std::string(argv[i]) + "/guests").c_str(), BM_guests, argv[i]);
         }
         else
         {
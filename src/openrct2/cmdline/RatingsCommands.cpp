@@ -0,0 +1,195 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../core/Json.hpp"
+#include "../core/String.hpp"
+#include "../platform/platform.h"
+#include "../ride/Ride.h"
+#include "../ride/RideData.h"
+#include "../ride/RideRatings.h"
+#include "CommandLine.hpp"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+
+using namespace OpenRCT2;
+
+static exitcode_t HandleRatings(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::RatingsCommands[]{
+    // Main commands
+    DefineCommand("", "<park> [csv|json]", nullptr, HandleRatings), CommandTableEnd
+};
+
+struct RideTypeTiming
+{
+    int32_t NumRides{};
+    std::chrono::nanoseconds Duration{};
+};
+
+static double ToMilliseconds(std::chrono::nanoseconds duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+static std::string FormatRating(ride_rating rating)
+{
+    if (rating == RIDE_RATING_UNDEFINED)
+        return {};
+    return String::StdFormat("%d.%02d", rating / 100, rating % 100);
+}
+
+static json_t RatingToJson(ride_rating rating)
+{
+    if (rating == RIDE_RATING_UNDEFINED)
+        return nullptr;
+    return rating / 100.0;
+}
+
+static std::string QuoteCsv(const std::string& s)
+{
+    std::string result = "\"";
+    for (auto c : s)
+    {
+        if (c == '"')
+            result += '"';
+        result += c;
+    }
+    return result + "\"";
+}
+
+static void WriteCsv(const std::vector<RideRatingTiming>& timings, const std::map<std::string, RideTypeTiming>& typeTimings)
+{
+    Console::WriteLine("id,type,name,excitement,intensity,nausea,time_ms");
+    for (const auto& timing : timings)
+    {
+        auto ride = get_ride(timing.RideId);
+        if (ride == nullptr)
+            continue;
+
+        Console::WriteLine(
+            "%d,%s,%s,%s,%s,%s,%.3f", EnumValue(ride->id), ride->GetRideTypeDescriptor().EnumName,
+            QuoteCsv(ride->GetName()).c_str(), FormatRating(ride->excitement).c_str(), FormatRating(ride->intensity).c_str(),
+            FormatRating(ride->nausea).c_str(), ToMilliseconds(timing.Duration));
+    }
+
+    Console::WriteLine();
+    Console::WriteLine("type,rides,total_ms,mean_ms");
+    for (const auto& [type, typeTiming] : typeTimings)
+    {
+        auto total = ToMilliseconds(typeTiming.Duration);
+        Console::WriteLine("%s,%d,%.3f,%.3f", type.c_str(), typeTiming.NumRides, total, total / typeTiming.NumRides);
+    }
+}
+
+static void WriteJson(const std::vector<RideRatingTiming>& timings, const std::map<std::string, RideTypeTiming>& typeTimings)
+{
+    json_t rides = json_t::array();
+    for (const auto& timing : timings)
+    {
+        auto ride = get_ride(timing.RideId);
+        if (ride == nullptr)
+            continue;
+
+        rides.push_back({
+            { "id", EnumValue(ride->id) },
+            { "type", ride->GetRideTypeDescriptor().EnumName },
+            { "name", ride->GetName() },
+            { "excitement", RatingToJson(ride->excitement) },
+            { "intensity", RatingToJson(ride->intensity) },
+            { "nausea", RatingToJson(ride->nausea) },
+            { "timeMs", ToMilliseconds(timing.Duration) },
+        });
+    }
+
+    json_t rideTypes = json_t::array();
+    for (const auto& [type, typeTiming] : typeTimings)
+    {
+        auto total = ToMilliseconds(typeTiming.Duration);
+        rideTypes.push_back({
+            { "type", type },
+            { "rides", typeTiming.NumRides },
+            { "totalMs", total },
+            { "meanMs", total / typeTiming.NumRides },
+        });
+    }
+
+    json_t result = { { "rides", rides }, { "rideTypes", rideTypes } };
+    Console::WriteLine("%s", result.dump(4).c_str());
+}
+
+static exitcode_t HandleRatings(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 1)
+    {
+        Console::Error::WriteLine("Missing argument <park>.");
+        return EXITCODE_FAIL;
+    }
+
+    const char* inputPath = argv[0];
+    bool asJson = false;
+    if (argc >= 2)
+    {
+        if (String::Equals(argv[1], "json", true))
+        {
+            asJson = true;
+        }
+        else if (!String::Equals(argv[1], "csv", true))
+        {
+            Console::Error::WriteLine("Unknown format '%s', expected csv or json.", argv[1]);
+            return EXITCODE_FAIL;
+        }
+    }
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto timings = ride_ratings_update_all_instant();
+
+    std::map<std::string, RideTypeTiming> typeTimings;
+    for (const auto& timing : timings)
+    {
+        auto ride = get_ride(timing.RideId);
+        if (ride != nullptr)
+        {
+            auto& typeTiming = typeTimings[ride->GetRideTypeDescriptor().EnumName];
+            typeTiming.NumRides++;
+            typeTiming.Duration += timing.Duration;
+        }
+    }
+
+    if (asJson)
+    {
+        WriteJson(timings, typeTimings);
+    }
+    else
+    {
+        WriteCsv(timings, typeTimings);
+    }
+    return EXITCODE_OK;
+}
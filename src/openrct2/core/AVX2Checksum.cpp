@@ -0,0 +1,69 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ChecksumStream.h"
+
+#include "Guard.hpp"
+
+#ifndef DISABLE_NETWORK
+
+#    ifdef __AVX2__
+
+#        include <immintrin.h>
+
+namespace OpenRCT2
+{
+    void checksum_accumulate_avx2(uint64_t* lanes, const std::byte* data, size_t numStripes, uint64_t firstStripe)
+    {
+        static_assert(ChecksumStream::StripeSize == sizeof(__m256i));
+        const auto& keys = ChecksumStream::LaneKeys;
+        const __m256i key = _mm256_set_epi64x(
+            static_cast<int64_t>(keys[3]), static_cast<int64_t>(keys[2]), static_cast<int64_t>(keys[1]),
+            static_cast<int64_t>(keys[0]));
+        const __m256i stripeKeyStep = _mm256_set1_epi64x(static_cast<int64_t>(ChecksumStream::StripeKeyStep));
+        __m256i stripeKey = _mm256_set1_epi64x(static_cast<int64_t>(firstStripe * ChecksumStream::StripeKeyStep));
+
+        __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes));
+        for (size_t stripe = 0; stripe < numStripes; stripe++)
+        {
+            const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            const __m256i keyed = _mm256_xor_si256(value, _mm256_add_epi64(key, stripeKey));
+
+            // (keyed & 0xFFFFFFFF) * (keyed >> 32) for every lane.
+            const __m256i keyedHigh = _mm256_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1));
+            const __m256i product = _mm256_mul_epu32(keyed, keyedHigh);
+
+            // Each value is also added to its neighbouring lane.
+            const __m256i swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+            acc = _mm256_add_epi64(acc, _mm256_add_epi64(product, swapped));
+
+            stripeKey = _mm256_add_epi64(stripeKey, stripeKeyStep);
+            data += ChecksumStream::StripeSize;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    }
+} // namespace OpenRCT2
+
+#    else
+
+#        ifdef OPENRCT2_X86
+#            error You have to compile this file with AVX2 enabled, when targeting x86!
+#        endif
+
+namespace OpenRCT2
+{
+    void checksum_accumulate_avx2(uint64_t* lanes, const std::byte* data, size_t numStripes, uint64_t firstStripe)
+    {
+        openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+    }
+} // namespace OpenRCT2
+
+#    endif // __AVX2__
+
+#endif // DISABLE_NETWORK
@@ -9,6 +9,7 @@
 
 #include "ChecksumStream.h"
 
+#include "../util/Util.h"
 #include "Endianness.h"
 
 #include <cstddef>
@@ -16,14 +17,82 @@
 namespace OpenRCT2
 {
 #ifndef DISABLE_NETWORK
-    ChecksumStream::ChecksumStream(std::array<std::byte, 20>& buf)
+    static constexpr uint64_t MergePrime1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t MergePrime2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr uint64_t MergePrime3 = 0x165667B19E3779F9ULL;
+    static constexpr uint64_t MergePrime4 = 0x85EBCA77C2B2AE63ULL;
+
+    static uint64_t LoadLittleEndian64(const std::byte* data)
+    {
+        uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+#    if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        value = ByteSwapBE(value);
+#    endif
+        return value;
+    }
+
+    static uint64_t Avalanche(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= MergePrime2;
+        value ^= value >> 29;
+        value *= MergePrime3;
+        value ^= value >> 32;
+        return value;
+    }
+
+    void checksum_accumulate_scalar(uint64_t* lanes, const std::byte* data, size_t numStripes, uint64_t firstStripe)
+    {
+        uint64_t stripeKey = firstStripe * ChecksumStream::StripeKeyStep;
+        for (size_t stripe = 0; stripe < numStripes; stripe++)
+        {
+            for (size_t i = 0; i < ChecksumStream::NumLanes; i++)
+            {
+                const uint64_t value = LoadLittleEndian64(data + i * sizeof(uint64_t));
+                const uint64_t keyed = value ^ (ChecksumStream::LaneKeys[i] + stripeKey);
+                lanes[i ^ 1] += value;
+                lanes[i] += (keyed & 0xFFFFFFFF) * (keyed >> 32);
+            }
+            stripeKey += ChecksumStream::StripeKeyStep;
+            data += ChecksumStream::StripeSize;
+        }
+    }
+
+    static void checksum_accumulate(uint64_t* lanes, const std::byte* data, size_t numStripes, uint64_t firstStripe)
+    {
+        static const auto accumulateFn = avx2_available() ? checksum_accumulate_avx2 : checksum_accumulate_scalar;
+        accumulateFn(lanes, data, numStripes, firstStripe);
+    }
+
+    ChecksumStream::ChecksumStream(std::array<std::byte, 20>& buf, ChecksumAlgorithm algorithm)
         : _checksum(buf)
+        , _algorithm(algorithm)
     {
-        uint64_t* hash = reinterpret_cast<uint64_t*>(_checksum.data());
-        *hash = Seed;
+        if (_algorithm == ChecksumAlgorithm::MultiLane)
+        {
+            _lanes = { MergePrime3, MergePrime1, MergePrime2, MergePrime4 };
+        }
+        else
+        {
+            uint64_t* hash = reinterpret_cast<uint64_t*>(_checksum.data());
+            *hash = Seed;
+        }
     }
 
     void ChecksumStream::Write(const void* buffer, uint64_t length)
+    {
+        if (_algorithm == ChecksumAlgorithm::MultiLane)
+        {
+            WriteMultiLane(buffer, length);
+        }
+        else
+        {
+            WriteFnv64(buffer, length);
+        }
+    }
+
+    void ChecksumStream::WriteFnv64(const void* buffer, uint64_t length)
     {
         uint64_t* hash = reinterpret_cast<uint64_t*>(_checksum.data());
         for (size_t i = 0; i < length; i += sizeof(uint64_t))
@@ -43,5 +112,62 @@ namespace OpenRCT2
         }
     }
 
+    void ChecksumStream::WriteMultiLane(const void* buffer, uint64_t length)
+    {
+        auto src = reinterpret_cast<const std::byte*>(buffer);
+        while (length > 0)
+        {
+            if (_blockLength == 0 && length >= BlockSize)
+            {
+                // Hash whole stripes straight from the source.
+                const size_t numStripes = static_cast<size_t>(length / StripeSize);
+                checksum_accumulate(_lanes.data(), src, numStripes, _totalLength / StripeSize);
+                const size_t consumed = numStripes * StripeSize;
+                _totalLength += consumed;
+                src += consumed;
+                length -= consumed;
+                continue;
+            }
+
+            const size_t copyLength = std::min<size_t>(BlockSize - _blockLength, length);
+            std::memcpy(_block.data() + _blockLength, src, copyLength);
+            _blockLength += copyLength;
+            src += copyLength;
+            length -= copyLength;
+
+            if (_blockLength == BlockSize)
+            {
+                checksum_accumulate(_lanes.data(), _block.data(), BlockSize / StripeSize, _totalLength / StripeSize);
+                _totalLength += BlockSize;
+                _blockLength = 0;
+            }
+        }
+    }
+
+    void ChecksumStream::Finish()
+    {
+        if (_algorithm != ChecksumAlgorithm::MultiLane || _finished)
+            return;
+
+        // Pad the remaining data with zeroes to whole stripes, the length is mixed in below.
+        const size_t numStripes = (_blockLength + StripeSize - 1) / StripeSize;
+        std::fill(_block.begin() + _blockLength, _block.begin() + numStripes * StripeSize, std::byte{ 0 });
+        checksum_accumulate(_lanes.data(), _block.data(), numStripes, _totalLength / StripeSize);
+        _totalLength += _blockLength;
+        _blockLength = 0;
+
+        uint64_t hash = _totalLength * MergePrime1;
+        for (auto lane : _lanes)
+        {
+            hash ^= Avalanche(lane);
+            hash = ((hash << 27) | (hash >> 37)) * MergePrime1 + MergePrime4;
+        }
+        hash = Avalanche(hash);
+
+        _checksum = {};
+        std::memcpy(_checksum.data(), &hash, sizeof(hash));
+        _finished = true;
+    }
+
 #endif
 } // namespace OpenRCT2
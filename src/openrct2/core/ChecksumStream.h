@@ -13,24 +13,64 @@
 #include "IStream.hpp"
 
 #include <array>
+#include <cstring>
 
 namespace OpenRCT2
 {
+    enum class ChecksumAlgorithm : uint8_t
+    {
+        // 64-bit FNV style hash of every write, kept for the checksums stored in replays.
+        Fnv64,
+        // Four 64-bit lanes over a buffered byte stream, the lanes are updated with SIMD where available.
+        MultiLane,
+    };
+
     /**
      * A stream for checksumming a stream of data
      */
     class ChecksumStream final : public IStream
     {
+    public:
+        static constexpr size_t NumLanes = 4;
+        static constexpr size_t StripeSize = NumLanes * sizeof(uint64_t);
+        static constexpr std::array<uint64_t, NumLanes> LaneKeys = {
+            0xbe4ba423396cfeb8ULL,
+            0x1cad21f72c81017cULL,
+            0xdb979083e96dd4deULL,
+            0x1f67b3b7a4a44072ULL,
+        };
+        // Added to the lane keys for every stripe, so the same data at a different offset hashes differently.
+        static constexpr uint64_t StripeKeyStep = 0x9E3779B97F4A7C15ULL;
+
+    private:
+        static constexpr size_t BlockSize = 16 * StripeSize;
+
         // FIXME: Move the checksum implementation out.
         std::array<std::byte, 20>& _checksum;
+        ChecksumAlgorithm _algorithm;
+
+        // State of ChecksumAlgorithm::MultiLane.
+        std::array<uint64_t, NumLanes> _lanes{};
+        std::array<std::byte, BlockSize> _block{};
+        size_t _blockLength{};
+        uint64_t _totalLength{};
+        bool _finished{};
 
         static constexpr uint64_t Seed = 0xcbf29ce484222325ULL;
         static constexpr uint64_t Prime = 0x00000100000001B3ULL;
 
     public:
-        ChecksumStream(std::array<std::byte, 20>& buf);
+        ChecksumStream(std::array<std::byte, 20>& buf, ChecksumAlgorithm algorithm = ChecksumAlgorithm::Fnv64);
 
-        virtual ~ChecksumStream() = default;
+        virtual ~ChecksumStream()
+        {
+            Finish();
+        }
+
+        /**
+         * Writes the final checksum to the buffer, called by the destructor. No more data may be written afterwards.
+         */
+        void Finish();
 
         const void* GetData() const override
         {
@@ -100,6 +140,12 @@ namespace OpenRCT2
 
         template<size_t N> void Write(const void* buffer)
         {
+            if (_algorithm == ChecksumAlgorithm::MultiLane && _blockLength + N <= BlockSize)
+            {
+                std::memcpy(_block.data() + _blockLength, buffer, N);
+                _blockLength += N;
+                return;
+            }
             Write(buffer, N);
         }
 
@@ -107,6 +153,17 @@ namespace OpenRCT2
         {
             return 0;
         }
+
+    private:
+        void WriteFnv64(const void* buffer, uint64_t length);
+        void WriteMultiLane(const void* buffer, uint64_t length);
     };
 
+    /**
+     * Updates the lanes with numStripes stripes of StripeSize bytes each, firstStripe is the index of the first stripe in
+     * the stream. The SIMD variants must produce the same result as the scalar one.
+     */
+    void checksum_accumulate_scalar(uint64_t* lanes, const std::byte* data, size_t numStripes, uint64_t firstStripe);
+    void checksum_accumulate_avx2(uint64_t* lanes, const std::byte* data, size_t numStripes, uint64_t firstStripe);
+
 } // namespace OpenRCT2
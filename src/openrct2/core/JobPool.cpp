@@ -9,81 +9,278 @@
 
 #include "JobPool.h"
 
-#include <algorithm>
 #include <cassert>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <thread>
 
-JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
-    : WorkFn(workFn)
-    , CompletionFn(completionFn)
+/**
+ * Owns the worker threads. Every worker has its own deque, tasks added from a worker go to the back of its own deque
+ * and are popped from there again (LIFO, keeps nested work hot in cache), idle workers steal from the front of the
+ * other deques. Threads only sleep when there is no queued task at all.
+ */
+class JobScheduler
 {
-}
+private:
+    static constexpr size_t NoWorker = static_cast<size_t>(-1);
 
-JobPool::JobPool(size_t maxThreads)
-{
-    maxThreads = std::min<size_t>(maxThreads, std::thread::hardware_concurrency());
-    for (size_t n = 0; n < maxThreads; n++)
+    struct QueuedTask
+    {
+        JobPool::Task Work;
+        JobPool::Task Completion;
+        JobPool* Pool;
+    };
+
+    struct alignas(64) WorkerQueue
+    {
+        std::mutex Mutex;
+        std::deque<QueuedTask> Tasks;
+    };
+
+    static thread_local size_t _workerIndex;
+
+    std::vector<std::unique_ptr<WorkerQueue>> _queues;
+    std::vector<std::thread> _threads;
+    std::atomic<size_t> _pending = { 0 };
+    std::atomic<size_t> _sleeping = { 0 };
+    std::atomic<size_t> _nextQueue = { 0 };
+    std::atomic_bool _shouldStop = { false };
+    std::condition_variable _condPending;
+    std::mutex _sleepMutex;
+
+public:
+    static JobScheduler& Get()
     {
-        _threads.emplace_back(&JobPool::ProcessQueue, this);
+        static JobScheduler scheduler;
+        return scheduler;
     }
-}
 
-JobPool::~JobPool()
-{
+    JobScheduler()
     {
-        unique_lock lock(_mutex);
-        _shouldStop = true;
-        _condPending.notify_all();
+        const size_t numWorkers = std::max<size_t>(1, std::thread::hardware_concurrency());
+        for (size_t n = 0; n < numWorkers; n++)
+        {
+            _queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (size_t n = 0; n < numWorkers; n++)
+        {
+            _threads.emplace_back(&JobScheduler::ProcessQueue, this, n);
+        }
+    }
+
+    ~JobScheduler()
+    {
+        {
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _shouldStop = true;
+            _condPending.notify_all();
+        }
+
+        for (auto& th : _threads)
+        {
+            assert(th.joinable() != false);
+            th.join();
+        }
+    }
+
+    size_t GetWorkerCount() const
+    {
+        return _threads.size();
+    }
+
+    void Enqueue(JobPool* pool, JobPool::Task&& workFn, JobPool::Task&& completionFn)
+    {
+        size_t queueIndex = _workerIndex;
+        if (queueIndex == NoWorker)
+        {
+            queueIndex = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+        }
+
+        auto& queue = *_queues[queueIndex];
+        {
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            queue.Tasks.push_back(QueuedTask{ std::move(workFn), std::move(completionFn), pool });
+        }
+
+        _pending++;
+        if (_sleeping > 0)
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _condPending.notify_one();
+        }
     }
 
-    for (auto& th : _threads)
+    /**
+     * Runs a single queued task, if pool is set only tasks of that pool are considered.
+     */
+    bool TryRunTask(JobPool* pool)
     {
-        assert(th.joinable() != false);
-        th.join();
+        auto task = TryPop(pool);
+        if (!task.has_value())
+            return false;
+
+        Run(*task);
+        return true;
+    }
+
+private:
+    static bool TryPopFrom(WorkerQueue& queue, JobPool* pool, bool fromBack, std::optional<QueuedTask>& result)
+    {
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        if (queue.Tasks.empty())
+            return false;
+
+        if (pool == nullptr)
+        {
+            if (fromBack)
+            {
+                result.emplace(std::move(queue.Tasks.back()));
+                queue.Tasks.pop_back();
+            }
+            else
+            {
+                result.emplace(std::move(queue.Tasks.front()));
+                queue.Tasks.pop_front();
+            }
+            return true;
+        }
+
+        auto it = std::find_if(queue.Tasks.begin(), queue.Tasks.end(), [pool](const QueuedTask& t) { return t.Pool == pool; });
+        if (it == queue.Tasks.end())
+            return false;
+
+        result.emplace(std::move(*it));
+        queue.Tasks.erase(it);
+        return true;
+    }
+
+    std::optional<QueuedTask> TryPop(JobPool* pool)
+    {
+        std::optional<QueuedTask> result;
+        if (_pending == 0)
+            return result;
+
+        const size_t numQueues = _queues.size();
+        const size_t ownIndex = _workerIndex;
+        size_t startIndex = 0;
+        if (ownIndex != NoWorker)
+        {
+            if (TryPopFrom(*_queues[ownIndex], pool, true, result))
+            {
+                _pending--;
+                result->Pool->OnTaskStarted();
+                return result;
+            }
+            startIndex = ownIndex + 1;
+        }
+
+        // Steal from the other workers, oldest tasks first.
+        for (size_t n = 0; n < numQueues; n++)
+        {
+            const size_t queueIndex = (startIndex + n) % numQueues;
+            if (queueIndex == ownIndex)
+                continue;
+
+            if (TryPopFrom(*_queues[queueIndex], pool, false, result))
+            {
+                _pending--;
+                result->Pool->OnTaskStarted();
+                return result;
+            }
+        }
+        return result;
+    }
+
+    static void Run(QueuedTask& task)
+    {
+        task.Work();
+        // Release the captures before the pool is told, a returning Join() may destroy what they refer to.
+        task.Work.Reset();
+        task.Pool->OnTaskCompleted(std::move(task.Completion));
+    }
+
+    void ProcessQueue(size_t index)
+    {
+        _workerIndex = index;
+        while (!_shouldStop)
+        {
+            if (TryRunTask(nullptr))
+                continue;
+
+            // Wait for work or cancellation.
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _sleeping++;
+            _condPending.wait(lock, [this]() { return _shouldStop || _pending > 0; });
+            _sleeping--;
+        }
+    }
+};
+
+thread_local size_t JobScheduler::_workerIndex = JobScheduler::NoWorker;
+
+JobPool::~JobPool()
+{
+    if (_remaining > 0)
+    {
+        Join();
     }
 }
 
-void JobPool::AddTask(std::function<void()> workFn, std::function<void()> completionFn)
+void JobPool::AddTask(Task workFn, Task completionFn)
 {
+    _remaining++;
+    _queued++;
+    JobScheduler::Get().Enqueue(this, std::move(workFn), std::move(completionFn));
+
     unique_lock lock(_mutex);
-    _pending.emplace_back(workFn, completionFn);
-    _condPending.notify_one();
+    if (_waiters > 0)
+    {
+        // A task of this pool added more work while Join() is waiting, wake it up to help.
+        _cond.notify_all();
+    }
 }
 
 void JobPool::Join(std::function<void()> reportFn)
 {
-    unique_lock lock(_mutex);
+    auto& scheduler = JobScheduler::Get();
     while (true)
     {
-        // Wait for the queue to become empty or having completed tasks.
-        _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
+        // Help with the tasks of this pool rather than waiting for a worker to pick them up.
+        while (scheduler.TryRunTask(this))
+        {
+            if (reportFn)
+            {
+                reportFn();
+            }
+        }
 
-        // Dispatch all completion callbacks if there are any.
-        while (!_completed.empty())
+        std::vector<Task> completed;
         {
-            auto taskData = _completed.front();
-            _completed.pop_front();
+            unique_lock lock(_mutex);
 
-            if (taskData.CompletionFn)
-            {
-                lock.unlock();
+            // Wait for the pool to run dry, have completed tasks or have tasks this thread can help with.
+            _waiters++;
+            _cond.wait(lock, [this]() { return _remaining == 0 || !_completed.empty() || _queued > 0; });
+            _waiters--;
 
-                taskData.CompletionFn();
+            completed.swap(_completed);
+        }
 
-                lock.lock();
-            }
+        // Dispatch all completion callbacks if there are any.
+        for (auto& completionFn : completed)
+        {
+            completionFn();
         }
 
         if (reportFn)
         {
-            lock.unlock();
-
             reportFn();
-
-            lock.lock();
         }
 
         // If everything is empty and no more work has to be done we can stop waiting.
-        if (_completed.empty() && _pending.empty() && _processing == 0)
+        unique_lock lock(_mutex);
+        if (_remaining == 0 && _completed.empty())
         {
             break;
         }
@@ -92,34 +289,30 @@ void JobPool::Join(std::function<void()> reportFn)
 
 size_t JobPool::CountPending()
 {
-    return _pending.size();
+    return _queued;
 }
 
-void JobPool::ProcessQueue()
+size_t JobPool::GetWorkerCount()
 {
-    unique_lock lock(_mutex);
-    do
-    {
-        // Wait for work or cancellation.
-        _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
-
-        if (!_pending.empty())
-        {
-            _processing++;
-
-            auto taskData = _pending.front();
-            _pending.pop_front();
-
-            lock.unlock();
-
-            taskData.WorkFn();
-
-            lock.lock();
+    return JobScheduler::Get().GetWorkerCount();
+}
 
-            _completed.push_back(std::move(taskData));
+void JobPool::OnTaskStarted()
+{
+    _queued--;
+}
 
-            _processing--;
-            _condComplete.notify_one();
-        }
-    } while (!_shouldStop);
+void JobPool::OnTaskCompleted(Task completionFn)
+{
+    // The lock is held until after the notify so the pool is not destroyed by a returning Join() while in use here.
+    unique_lock lock(_mutex);
+    if (completionFn)
+    {
+        _completed.push_back(std::move(completionFn));
+    }
+    _remaining--;
+    if (_waiters > 0)
+    {
+        _cond.notify_all();
+    }
 }
@@ -9,44 +9,229 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
-#include <deque>
+#include <cstddef>
 #include <functional>
 #include <mutex>
-#include <thread>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+/**
+ * A group of tasks that run on the shared work-stealing scheduler. Creating a JobPool is cheap, the worker threads
+ * are created once and shared by every pool, Join() only waits for the tasks that were added to this pool.
+ */
 class JobPool
 {
-private:
-    struct TaskData
+public:
+    /**
+     * Move-only callable with inline storage, queuing a task does not allocate unless the captures are large.
+     */
+    class Task
     {
-        const std::function<void()> WorkFn;
-        const std::function<void()> CompletionFn;
+    private:
+        static constexpr size_t InlineSize = 64;
+
+        struct Operations
+        {
+            void (*Invoke)(void* storage);
+            void (*Move)(void* dst, void* src);
+            void (*Destroy)(void* storage);
+        };
+
+        template<typename TFn> struct InlineOperations
+        {
+            static void Invoke(void* storage)
+            {
+                (*static_cast<TFn*>(storage))();
+            }
+            static void Move(void* dst, void* src)
+            {
+                new (dst) TFn(std::move(*static_cast<TFn*>(src)));
+                static_cast<TFn*>(src)->~TFn();
+            }
+            static void Destroy(void* storage)
+            {
+                static_cast<TFn*>(storage)->~TFn();
+            }
+            static constexpr Operations Table = { Invoke, Move, Destroy };
+        };
+
+        template<typename TFn> struct HeapOperations
+        {
+            static TFn*& Get(void* storage)
+            {
+                return *static_cast<TFn**>(storage);
+            }
+            static void Invoke(void* storage)
+            {
+                (*Get(storage))();
+            }
+            static void Move(void* dst, void* src)
+            {
+                new (dst) TFn*(Get(src));
+            }
+            static void Destroy(void* storage)
+            {
+                delete Get(storage);
+            }
+            static constexpr Operations Table = { Invoke, Move, Destroy };
+        };
+
+        alignas(std::max_align_t) unsigned char _storage[InlineSize];
+        const Operations* _ops = nullptr;
+
+    public:
+        Task() = default;
+        Task(std::nullptr_t)
+        {
+        }
+
+        template<typename TFn, typename = std::enable_if_t<!std::is_same_v<std::decay_t<TFn>, Task>>> Task(TFn&& fn)
+        {
+            using TStored = std::decay_t<TFn>;
+            if constexpr (std::is_same_v<TStored, std::function<void()>>)
+            {
+                if (!fn)
+                    return;
+            }
+            if constexpr (
+                sizeof(TStored) <= InlineSize && alignof(TStored) <= alignof(std::max_align_t)
+                && std::is_nothrow_move_constructible_v<TStored>)
+            {
+                new (_storage) TStored(std::forward<TFn>(fn));
+                _ops = &InlineOperations<TStored>::Table;
+            }
+            else
+            {
+                new (_storage) TStored*(new TStored(std::forward<TFn>(fn)));
+                _ops = &HeapOperations<TStored>::Table;
+            }
+        }
+
+        Task(Task&& other) noexcept
+        {
+            *this = std::move(other);
+        }
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                if (other._ops != nullptr)
+                {
+                    other._ops->Move(_storage, other._storage);
+                    _ops = other._ops;
+                    other._ops = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task()
+        {
+            Reset();
+        }
 
-        TaskData(std::function<void()> workFn, std::function<void()> completionFn);
+        void Reset()
+        {
+            if (_ops != nullptr)
+            {
+                _ops->Destroy(_storage);
+                _ops = nullptr;
+            }
+        }
+
+        explicit operator bool() const
+        {
+            return _ops != nullptr;
+        }
+
+        void operator()()
+        {
+            _ops->Invoke(_storage);
+        }
     };
 
-    std::atomic_bool _shouldStop = { false };
-    std::atomic<size_t> _processing = { 0 };
-    std::vector<std::thread> _threads;
-    std::deque<TaskData> _pending;
-    std::deque<TaskData> _completed;
-    std::condition_variable _condPending;
-    std::condition_variable _condComplete;
+private:
+    std::atomic<size_t> _queued = { 0 };
+    std::atomic<size_t> _remaining = { 0 };
+    size_t _waiters = 0;
+    std::vector<Task> _completed;
+    std::condition_variable _cond;
     std::mutex _mutex;
 
     using unique_lock = std::unique_lock<std::mutex>;
 
 public:
-    JobPool(size_t maxThreads = 255);
+    JobPool() = default;
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
     ~JobPool();
 
-    void AddTask(std::function<void()> workFn, std::function<void()> completionFn = nullptr);
+    /**
+     * Queues workFn on the shared scheduler. completionFn is invoked on the thread calling Join() once workFn has run.
+     * Tasks may add further tasks to the pool they belong to, these are pushed to the local deque of the worker.
+     */
+    void AddTask(Task workFn, Task completionFn = nullptr);
+
+    /**
+     * Waits for all tasks of this pool to finish. The calling thread helps by running the queued tasks of this pool
+     * and dispatches the completion callbacks, reportFn is called each time progress was made.
+     */
     void Join(std::function<void()> reportFn = nullptr);
+
     size_t CountPending();
 
+    /**
+     * Calls fn(i) for every i in [0, count) split into chunks of grainSize across the workers, the calling thread
+     * runs the first chunk itself and returns once every index has been processed. Any other tasks in this pool
+     * are joined as well.
+     */
+    template<typename TFn> void ParallelFor(size_t count, TFn&& fn, size_t grainSize = 0)
+    {
+        if (count == 0)
+            return;
+
+        if (grainSize == 0)
+        {
+            grainSize = std::max<size_t>(1, count / (GetWorkerCount() * 4));
+        }
+
+        for (size_t begin = grainSize; begin < count; begin += grainSize)
+        {
+            const size_t end = std::min(begin + grainSize, count);
+            AddTask([&fn, begin, end]() {
+                for (size_t i = begin; i < end; i++)
+                {
+                    fn(i);
+                }
+            });
+        }
+
+        const size_t firstEnd = std::min(grainSize, count);
+        for (size_t i = 0; i < firstEnd; i++)
+        {
+            fn(i);
+        }
+        Join();
+    }
+
+    /**
+     * Returns the number of worker threads of the shared scheduler.
+     */
+    static size_t GetWorkerCount();
+
 private:
-    void ProcessQueue();
+    friend class JobScheduler;
+
+    void OnTaskStarted();
+    void OnTaskCompleted(Task completionFn);
 };
@@ -9,16 +9,22 @@
 
 #pragma once
 
+#include "../util/Util.h"
 #include "../world/Location.hpp"
 #include "Crypt.h"
 #include "FileStream.h"
 #include "Identifier.hpp"
+#include "JobPool.h"
 #include "MemoryStream.h"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <sstream>
 #include <stack>
 #include <type_traits>
@@ -37,6 +43,11 @@ namespace OpenRCT2
 
         static constexpr uint32_t COMPRESSION_NONE = 0;
         static constexpr uint32_t COMPRESSION_GZIP = 1;
+        // Every chunk is compressed on its own in blocks of up to CompressionBlockSize bytes. The compressed data
+        // starts with the block table so blocks, and therefore chunks, can be decompressed independently.
+        static constexpr uint32_t COMPRESSION_GZIP_CHUNKS = 2;
+
+        static constexpr size_t CompressionBlockSize = 1024 * 1024;
 
     private:
 #pragma pack(push, 1)
@@ -60,6 +71,14 @@ namespace OpenRCT2
             uint64_t Offset{};
             uint64_t Length{};
         };
+
+        struct CompressedBlock
+        {
+            uint64_t UncompressedOffset{};
+            uint32_t UncompressedLength{};
+            uint32_t CompressedLength{};
+        };
+        static_assert(sizeof(CompressedBlock) == 16, "CompressedBlock should be 16 bytes");
 #pragma pack(pop)
 
         IStream* _stream;
@@ -69,6 +88,10 @@ namespace OpenRCT2
         MemoryStream _buffer;
         ChunkEntry _currentChunk;
 
+        // Blocks of a COMPRESSION_GZIP_CHUNKS stream being read and where their data starts in _buffer.
+        std::vector<CompressedBlock> _blocks;
+        std::vector<uint64_t> _blockDataOffsets;
+
     public:
         OrcaStream(IStream& stream, const Mode mode)
         {
@@ -108,65 +131,55 @@ namespace OpenRCT2
                     _buffer.Clear();
                     _buffer.Write(uncompressedData.data(), uncompressedData.size());
                 }
+                else if (_header.Compression == COMPRESSION_GZIP_CHUNKS)
+                {
+                    // The chunks are decompressed when they are read, see ReadWriteChunk().
+                    ReadBlockTable();
+                }
             }
             else
             {
                 _header = {};
-                _header.Compression = COMPRESSION_GZIP;
+                _header.Compression = COMPRESSION_GZIP_CHUNKS;
 
                 _buffer = MemoryStream{};
             }
         }
 
+        /**
+         * Creates a stream for writing that is not bound to an output stream, the data is taken with TakeWriter().
+         */
+        OrcaStream()
+        {
+            _stream = nullptr;
+            _mode = Mode::WRITING;
+            _header = {};
+            _header.Compression = COMPRESSION_GZIP_CHUNKS;
+        }
+
         OrcaStream(const OrcaStream&) = delete;
 
         ~OrcaStream()
         {
-            if (_mode == Mode::WRITING)
+            if (_mode == Mode::WRITING && _stream != nullptr)
             {
-                const void* uncompressedData = _buffer.GetData();
-                const uint64_t uncompressedSize = _buffer.GetLength();
-
-                _header.NumChunks = static_cast<uint32_t>(_chunks.size());
-                _header.UncompressedSize = uncompressedSize;
-                _header.CompressedSize = uncompressedSize;
-                _header.FNV1a = Crypt::FNV1a(uncompressedData, uncompressedSize);
-
-                // Compress data
-                std::optional<std::vector<uint8_t>> compressedBytes;
-                if (_header.Compression == COMPRESSION_GZIP)
-                {
-                    compressedBytes = Gzip(uncompressedData, uncompressedSize);
-                    if (compressedBytes)
-                    {
-                        _header.CompressedSize = compressedBytes->size();
-                    }
-                    else
-                    {
-                        // Compression failed
-                        _header.Compression = COMPRESSION_NONE;
-                    }
-                }
-
-                // Write header and chunk table
-                _stream->WriteValue(_header);
-                for (const auto& chunk : _chunks)
-                {
-                    _stream->WriteValue(chunk);
-                }
-
-                // Write chunk data
-                if (compressedBytes)
-                {
-                    _stream->Write(compressedBytes->data(), compressedBytes->size());
-                }
-                else
-                {
-                    _stream->Write(uncompressedData, uncompressedSize);
-                }
+                Write(*_stream, _header, _chunks, _buffer);
             }
         }
 
+        /**
+         * Takes everything written so far, the returned function compresses it and writes it to the given stream. It
+         * only works on its own copy of the data so it can be run on another thread, the OrcaStream itself does not
+         * write anything afterwards.
+         */
+        std::function<void(IStream& stream)> TakeWriter()
+        {
+            auto buffer = std::make_shared<MemoryStream>(std::move(_buffer));
+            _buffer = MemoryStream{};
+            _stream = nullptr;
+            return [header = _header, chunks = _chunks, buffer](IStream& stream) { Write(stream, header, chunks, *buffer); };
+        }
+
         Mode GetMode() const
         {
             return _mode;
@@ -186,6 +199,19 @@ namespace OpenRCT2
         {
             if (_mode == Mode::READING)
             {
+                if (_header.Compression == COMPRESSION_GZIP_CHUNKS)
+                {
+                    const auto* chunk = FindChunk(chunkId);
+                    if (chunk == nullptr)
+                        return false;
+
+                    auto data = DecompressChunk(*chunk);
+                    MemoryStream chunkBuffer(data.data(), data.size(), MEMORY_ACCESS::READ);
+                    ChunkStream stream(chunkBuffer, _mode);
+                    f(stream);
+                    return true;
+                }
+
                 if (SeekChunk(chunkId))
                 {
                     ChunkStream stream(_buffer, _mode);
@@ -207,6 +233,219 @@ namespace OpenRCT2
         }
 
     private:
+        static void Write(IStream& stream, Header header, const std::vector<ChunkEntry>& chunks, const MemoryStream& buffer)
+        {
+            const void* uncompressedData = buffer.GetData();
+            const uint64_t uncompressedSize = buffer.GetLength();
+
+            header.NumChunks = static_cast<uint32_t>(chunks.size());
+            header.UncompressedSize = uncompressedSize;
+            header.CompressedSize = uncompressedSize;
+            header.FNV1a = Crypt::FNV1a(uncompressedData, uncompressedSize);
+
+            // Compress data
+            std::optional<std::vector<uint8_t>> compressedBytes;
+            if (header.Compression == COMPRESSION_GZIP)
+            {
+                compressedBytes = Gzip(uncompressedData, uncompressedSize);
+                if (compressedBytes)
+                {
+                    header.CompressedSize = compressedBytes->size();
+                }
+                else
+                {
+                    // Compression failed
+                    header.Compression = COMPRESSION_NONE;
+                }
+            }
+            else if (header.Compression == COMPRESSION_GZIP_CHUNKS)
+            {
+                compressedBytes = CompressChunks(chunks, uncompressedData, uncompressedSize);
+                if (compressedBytes)
+                {
+                    header.CompressedSize = compressedBytes->size();
+                }
+                else
+                {
+                    // Compression failed
+                    header.Compression = COMPRESSION_NONE;
+                }
+            }
+
+            // Write header and chunk table
+            stream.WriteValue(header);
+            for (const auto& chunk : chunks)
+            {
+                stream.WriteValue(chunk);
+            }
+
+            // Write chunk data
+            if (compressedBytes)
+            {
+                stream.Write(compressedBytes->data(), compressedBytes->size());
+            }
+            else
+            {
+                stream.Write(uncompressedData, uncompressedSize);
+            }
+        }
+
+        /**
+         * Splits the chunks into blocks and compresses the blocks in parallel.
+         */
+        static std::optional<std::vector<uint8_t>> CompressChunks(
+            const std::vector<ChunkEntry>& chunks, const void* data, const uint64_t dataLength)
+        {
+            std::vector<CompressedBlock> blocks;
+            for (const auto& chunk : chunks)
+            {
+                for (uint64_t offset = 0; offset < chunk.Length; offset += CompressionBlockSize)
+                {
+                    CompressedBlock block;
+                    block.UncompressedOffset = chunk.Offset + offset;
+                    const auto length = std::min<uint64_t>(chunk.Length - offset, CompressionBlockSize);
+                    block.UncompressedLength = static_cast<uint32_t>(length);
+                    blocks.push_back(block);
+                }
+            }
+
+            const auto* src = static_cast<const uint8_t*>(data);
+            std::vector<std::vector<uint8_t>> compressedBlocks(blocks.size());
+            std::atomic_bool failed = false;
+            JobPool jobPool;
+            jobPool.ParallelFor(
+                blocks.size(),
+                [&](size_t i) {
+                    const auto& block = blocks[i];
+                    try
+                    {
+                        if (block.UncompressedOffset + block.UncompressedLength > dataLength)
+                            throw std::runtime_error("Chunk exceeds the stream.");
+                        compressedBlocks[i] = Gzip(src + block.UncompressedOffset, block.UncompressedLength);
+                    }
+                    catch (const std::exception&)
+                    {
+                        failed = true;
+                    }
+                },
+                1);
+            if (failed)
+            {
+                return std::nullopt;
+            }
+
+            MemoryStream result;
+            result.WriteValue(static_cast<uint32_t>(blocks.size()));
+            for (size_t i = 0; i < blocks.size(); i++)
+            {
+                blocks[i].CompressedLength = static_cast<uint32_t>(compressedBlocks[i].size());
+                result.WriteValue(blocks[i]);
+            }
+            for (const auto& compressedBlock : compressedBlocks)
+            {
+                result.Write(compressedBlock.data(), compressedBlock.size());
+            }
+
+            const auto* resultData = static_cast<const uint8_t*>(result.GetData());
+            return std::vector<uint8_t>(resultData, resultData + result.GetLength());
+        }
+
+        /**
+         * Reads the block table at the start of the compressed data written by CompressChunks().
+         */
+        void ReadBlockTable()
+        {
+            const auto dataLength = _buffer.GetLength();
+            MemoryStream compressed(_buffer.GetData(), static_cast<size_t>(dataLength));
+            const auto numBlocks = compressed.ReadValue<uint32_t>();
+            if (numBlocks > dataLength / sizeof(CompressedBlock))
+            {
+                throw std::runtime_error("Invalid block table.");
+            }
+
+            _blocks.resize(numBlocks);
+            _blockDataOffsets.resize(numBlocks);
+            uint64_t dataOffset = sizeof(uint32_t) + numBlocks * sizeof(CompressedBlock);
+            uint64_t uncompressedOffset = 0;
+            for (uint32_t i = 0; i < numBlocks; i++)
+            {
+                auto& block = _blocks[i];
+                block = compressed.ReadValue<CompressedBlock>();
+                _blockDataOffsets[i] = dataOffset;
+                dataOffset += block.CompressedLength;
+                if (dataOffset > dataLength || block.UncompressedOffset < uncompressedOffset
+                    || block.UncompressedOffset > _header.UncompressedSize
+                    || block.UncompressedLength > _header.UncompressedSize - block.UncompressedOffset)
+                {
+                    throw std::runtime_error("Invalid block table.");
+                }
+                uncompressedOffset = block.UncompressedOffset + block.UncompressedLength;
+            }
+        }
+
+        /**
+         * Decompresses the blocks of a chunk in parallel.
+         */
+        std::vector<uint8_t> DecompressChunk(const ChunkEntry& chunk) const
+        {
+            const auto chunkEnd = chunk.Offset + chunk.Length;
+            auto begin = std::lower_bound(
+                _blocks.begin(), _blocks.end(), chunk.Offset,
+                [](const CompressedBlock& block, uint64_t offset) { return block.UncompressedOffset < offset; });
+            auto end = std::lower_bound(
+                begin, _blocks.end(), chunkEnd,
+                [](const CompressedBlock& block, uint64_t offset) { return block.UncompressedOffset < offset; });
+
+            const auto firstBlock = static_cast<size_t>(begin - _blocks.begin());
+            const auto numBlocks = static_cast<size_t>(end - begin);
+            uint64_t coveredLength = 0;
+            for (auto it = begin; it != end; it++)
+            {
+                if (it->UncompressedOffset + it->UncompressedLength > chunkEnd)
+                    throw std::runtime_error("Block exceeds its chunk.");
+                coveredLength += it->UncompressedLength;
+            }
+            if (coveredLength != chunk.Length)
+            {
+                throw std::runtime_error("Chunk is not covered by its blocks.");
+            }
+
+            const auto* src = static_cast<const uint8_t*>(_buffer.GetData());
+            std::vector<uint8_t> result(static_cast<size_t>(chunk.Length));
+            std::atomic_bool failed = false;
+            JobPool jobPool;
+            jobPool.ParallelFor(
+                numBlocks,
+                [&](size_t i) {
+                    const auto& block = _blocks[firstBlock + i];
+                    try
+                    {
+                        auto uncompressed = Ungzip(src + _blockDataOffsets[firstBlock + i], block.CompressedLength);
+                        if (uncompressed.size() != block.UncompressedLength)
+                            throw std::runtime_error("Block has an unexpected length.");
+                        std::copy(
+                            uncompressed.begin(), uncompressed.end(),
+                            result.begin() + (block.UncompressedOffset - chunk.Offset));
+                    }
+                    catch (const std::exception&)
+                    {
+                        failed = true;
+                    }
+                },
+                1);
+            if (failed)
+            {
+                throw std::runtime_error("Failed to decompress chunk data.");
+            }
+            return result;
+        }
+
+        const ChunkEntry* FindChunk(const uint32_t id) const
+        {
+            const auto result = std::find_if(_chunks.begin(), _chunks.end(), [id](const ChunkEntry& e) { return e.Id == id; });
+            return result != _chunks.end() ? &*result : nullptr;
+        }
+
         bool SeekChunk(const uint32_t id)
         {
             const auto result = std::find_if(_chunks.begin(), _chunks.end(), [id](const ChunkEntry& e) { return e.Id == id; });
@@ -13,6 +13,7 @@
 #include "../core/ChecksumStream.h"
 #include "../core/Crypt.h"
 #include "../core/DataSerialiser.h"
+#include "../core/Endianness.h"
 #include "../core/Guard.hpp"
 #include "../core/MemoryStream.h"
 #include "../entity/Peep.h"
@@ -30,6 +31,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iterator>
 #include <numeric>
 #include <vector>
@@ -246,6 +248,107 @@ EntitiesChecksum GetAllEntitiesChecksum()
 
     return checksum;
 }
+
+struct EntityChecksumCacheEntry
+{
+    uint64_t MemoryHash;
+    uint64_t StateHash;
+    bool Valid;
+};
+
+// Checksum of the serialised state of every entity together with a hash of the memory it was computed from.
+static std::vector<EntityChecksumCacheEntry> _entityChecksumCache;
+
+static uint64_t ChecksumToHash(const std::array<std::byte, 20>& checksum)
+{
+    uint64_t hash;
+    std::memcpy(&hash, checksum.data(), sizeof(hash));
+    return hash;
+}
+
+template<typename T> static uint64_t GetEntityStateHash(T* entity)
+{
+    const auto index = entity->sprite_index;
+
+    // Hashing the raw memory is much cheaper than serialising, the serialised state can only change with the memory.
+    std::array<std::byte, 20> memoryChecksum{};
+    {
+        OpenRCT2::ChecksumStream ms(memoryChecksum, OpenRCT2::ChecksumAlgorithm::MultiLane);
+        ms.Write(&_entities[index], sizeof(Entity));
+    }
+    const auto memoryHash = ChecksumToHash(memoryChecksum);
+
+    auto& entry = _entityChecksumCache[index];
+    if (!entry.Valid || entry.MemoryHash != memoryHash)
+    {
+        std::array<std::byte, 20> stateChecksum{};
+        {
+            OpenRCT2::ChecksumStream ms(stateChecksum, OpenRCT2::ChecksumAlgorithm::MultiLane);
+            DataSerialiser ds(true, ms);
+            entity->Serialise(ds);
+        }
+        entry = { memoryHash, ChecksumToHash(stateChecksum), true };
+    }
+    return entry.StateHash;
+}
+
+template<typename T> static void GetEntityStateHashes(std::vector<std::pair<uint16_t, uint64_t>>& hashes)
+{
+    for (auto* entity : EntityList<T>())
+    {
+        hashes.emplace_back(entity->sprite_index, GetEntityStateHash(entity));
+    }
+}
+
+EntitiesChecksumTree GetEntitiesChecksumTree()
+{
+    if (_entityChecksumCache.empty())
+    {
+        _entityChecksumCache.resize(MAX_ENTITIES);
+    }
+
+    std::vector<std::pair<uint16_t, uint64_t>> hashes;
+    GetEntityStateHashes<Guest>(hashes);
+    GetEntityStateHashes<Staff>(hashes);
+    GetEntityStateHashes<Vehicle>(hashes);
+    GetEntityStateHashes<Litter>(hashes);
+    std::sort(hashes.begin(), hashes.end());
+
+    EntitiesChecksumTree tree;
+    tree.Ranges.resize(EntitiesChecksumTree::NumRanges);
+
+    auto it = hashes.begin();
+    for (size_t rangeIndex = 0; rangeIndex < EntitiesChecksumTree::NumRanges; rangeIndex++)
+    {
+        const auto rangeEnd = (rangeIndex + 1) * EntitiesChecksumTree::EntitiesPerRange;
+        if (it == hashes.end() || it->first >= rangeEnd)
+            continue;
+
+        std::array<std::byte, 20> rangeChecksum{};
+        {
+            OpenRCT2::ChecksumStream ms(rangeChecksum, OpenRCT2::ChecksumAlgorithm::MultiLane);
+            for (; it != hashes.end() && it->first < rangeEnd; it++)
+            {
+                // Same byte order on every platform.
+                const auto index = ByteSwapBE(it->first);
+                const auto stateHash = ByteSwapBE(it->second);
+                ms.Write(&index, sizeof(index));
+                ms.Write(&stateHash, sizeof(stateHash));
+            }
+        }
+        tree.Ranges[rangeIndex] = ChecksumToHash(rangeChecksum);
+    }
+
+    OpenRCT2::ChecksumStream ms(tree.Root.raw, OpenRCT2::ChecksumAlgorithm::MultiLane);
+    for (auto rangeHash : tree.Ranges)
+    {
+        rangeHash = ByteSwapBE(rangeHash);
+        ms.Write(&rangeHash, sizeof(rangeHash));
+    }
+    ms.Finish();
+
+    return tree;
+}
 #else
 
 EntitiesChecksum GetAllEntitiesChecksum()
@@ -253,6 +356,11 @@ EntitiesChecksum GetAllEntitiesChecksum()
     return EntitiesChecksum{};
 }
 
+EntitiesChecksumTree GetEntitiesChecksumTree()
+{
+    return EntitiesChecksumTree{};
+}
+
 #endif // DISABLE_NETWORK
 
 static void EntityReset(EntityBase* entity)
@@ -13,6 +13,7 @@
 #include "EntityBase.h"
 
 #include <array>
+#include <vector>
 
 constexpr uint16_t MAX_ENTITIES = 65535;
 
@@ -64,5 +65,20 @@ struct EntitiesChecksum
 #pragma pack(pop)
 EntitiesChecksum GetAllEntitiesChecksum();
 
+/**
+ * Checksum of the networked entities split into ranges of sprite indices. Entities whose memory did not change since the
+ * last call are not serialised again, comparing the ranges of two trees tells which entities diverged. Ranges without
+ * entities have a hash of 0.
+ */
+struct EntitiesChecksumTree
+{
+    static constexpr size_t EntitiesPerRange = 256;
+    static constexpr size_t NumRanges = (MAX_ENTITIES + EntitiesPerRange - 1) / EntitiesPerRange;
+
+    std::vector<uint64_t> Ranges;
+    EntitiesChecksum Root{};
+};
+EntitiesChecksumTree GetEntitiesChecksumTree();
+
 void EntitySetFlashing(EntityBase* entity, bool flashing);
 bool EntityGetFlashing(EntityBase* entity);
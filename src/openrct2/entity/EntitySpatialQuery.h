@@ -0,0 +1,39 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/Location.hpp"
+#include "../world/Map.h"
+#include "EntityList.h"
+
+#include <algorithm>
+
+/**
+ * Calls fn for every entity of type T on the tiles that are within range of loc, using the spatial index rather than
+ * walking the whole entity list. Tiles are visited in ascending x then y order and the entities on a tile in
+ * sprite_index order, so callers that need the lowest sprite_index on ties must compare it themselves.
+ */
+template<typename T, typename TFn> void ForEachEntityInRange(const CoordsXY& loc, int32_t range, TFn&& fn)
+{
+    const auto tileMin = TileCoordsXY{ std::max(loc.x - range, 0) / COORDS_XY_STEP,
+                                       std::max(loc.y - range, 0) / COORDS_XY_STEP };
+    const auto tileMax = TileCoordsXY{ std::min(loc.x + range, MAXIMUM_MAP_SIZE_BIG - 1) / COORDS_XY_STEP,
+                                       std::min(loc.y + range, MAXIMUM_MAP_SIZE_BIG - 1) / COORDS_XY_STEP };
+    for (int32_t tileX = tileMin.x; tileX <= tileMax.x; tileX++)
+    {
+        for (int32_t tileY = tileMin.y; tileY <= tileMax.y; tileY++)
+        {
+            for (auto* entity : EntityTileList<T>(TileCoordsXY{ tileX, tileY }.ToCoordsXY()))
+            {
+                fn(entity);
+            }
+        }
+    }
+}
@@ -32,6 +32,7 @@
 #include "../peep/RideUseSystem.h"
 #include "../rct2/RCT2.h"
 #include "../ride/Ride.h"
+#include "../ride/RideCandidateIndex.h"
 #include "../ride/RideData.h"
 #include "../ride/ShopItem.h"
 #include "../ride/Station.h"
@@ -1877,35 +1878,10 @@ BitSet<MAX_RIDES> Guest::FindRidesToGoOn()
     {
         // Take nearby rides into consideration
         constexpr auto radius = 10 * 32;
-        int32_t cx = floor2(x, 32);
-        int32_t cy = floor2(y, 32);
-        for (int32_t tileX = cx - radius; tileX <= cx + radius; tileX += COORDS_XY_STEP)
-        {
-            for (int32_t tileY = cy - radius; tileY <= cy + radius; tileY += COORDS_XY_STEP)
-            {
-                auto location = CoordsXY{ tileX, tileY };
-                if (!map_is_location_valid(location))
-                    continue;
-
-                for (auto* trackElement : TileElementsView<TrackElement>(location))
-                {
-                    auto rideIndex = trackElement->GetRideIndex();
-                    if (rideIndex != RIDE_ID_NULL)
-                    {
-                        rideConsideration[EnumValue(rideIndex)] = true;
-                    }
-                }
-            }
-        }
+        RideCandidateIndex::AddRidesNear({ x, y }, radius, rideConsideration);
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
-        for (auto& ride : GetRideManager())
-        {
-            if (ride.highest_drop_height > 66 || ride.excitement >= RIDE_RATING(8, 00))
-            {
-                rideConsideration[EnumValue(ride.id)] = true;
-            }
-        }
+        RideCandidateIndex::AddVisibleRides(rideConsideration);
     }
 
     return rideConsideration;
@@ -7544,3 +7520,30 @@ void Guest::Serialise(DataSerialiser& stream)
     stream << FavouriteRideRating;
     stream << ItemFlags;
 }
+
+GuestStatistics GetGuestStatistics()
+{
+    GuestStatistics stats;
+    for (auto guest : EntityList<Guest>())
+    {
+        if (guest->OutsideOfPark)
+            continue;
+
+        stats.GuestsInPark++;
+        if (guest->Happiness > 128)
+        {
+            stats.HappyGuests++;
+        }
+        if ((guest->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && guest->GuestIsLostCountdown < 90)
+        {
+            stats.LostGuests++;
+        }
+
+        const auto& thought = std::get<0>(guest->Thoughts);
+        if (thought.freshness <= 5)
+        {
+            stats.FreshThoughts[EnumValue(thought.type)]++;
+        }
+    }
+    return stats;
+}
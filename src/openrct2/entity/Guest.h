@@ -473,3 +473,29 @@ void increment_guests_in_park();
 void increment_guests_heading_for_park();
 void decrement_guests_in_park();
 void decrement_guests_heading_for_park();
+
+/**
+ * Aggregate state of the guests inside the park, gathered in a single pass over the guest list.
+ */
+struct GuestStatistics
+{
+    uint32_t GuestsInPark{};
+    uint32_t HappyGuests{};
+    uint32_t LostGuests{};
+
+    // Number of guests whose most recent thought is fresh (freshness <= 5), indexed by thought type.
+    std::array<uint32_t, 256> FreshThoughts{};
+
+    uint32_t CountFreshThoughts(PeepThoughtType type) const
+    {
+        return FreshThoughts[EnumValue(type)];
+    }
+
+    uint32_t CountUntidyThoughts() const
+    {
+        return CountFreshThoughts(PeepThoughtType::BadLitter) + CountFreshThoughts(PeepThoughtType::PathDisgusting)
+            + CountFreshThoughts(PeepThoughtType::Vandalism);
+    }
+};
+
+GuestStatistics GetGuestStatistics();
@@ -19,6 +19,7 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/JobPool.h"
 #include "../drawing/LightFX.h"
 #include "../entity/Balloon.h"
 #include "../entity/EntityRegistry.h"
@@ -56,6 +57,7 @@
 #include <algorithm>
 #include <iterator>
 #include <limits>
+#include <vector>
 
 uint8_t gGuestChangeModifier;
 uint32_t gNumGuestsInPark;
@@ -71,12 +73,16 @@ uint32_t gNextGuestNumber;
 
 uint8_t gPeepWarningThrottle[16];
 
+size_t gGuestTimerParallelThreshold = 2048;
+
 static uint8_t _unk_F1AEF0;
 static TileElement* _peepRideEntranceExitElement;
 
 static void* _crowdSoundChannel = nullptr;
 
 static void peep_128_tick_update(Peep* peep, int32_t index);
+static void peep_prepare_guest_timers();
+static void peep_update_guest(Guest* peep);
 static void peep_release_balloon(Guest* peep, int16_t spawn_height);
 
 static PeepActionSpriteType PeepSpecialSpriteToSpriteTypeMap[] = {
@@ -200,13 +206,15 @@ void peep_update_all()
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
         return;
 
+    peep_prepare_guest_timers();
+
     int32_t i = 0;
     // Warning this loop can delete peeps
     for (auto peep : EntityList<Guest>())
     {
         if (static_cast<uint32_t>(i & 0x7F) != (gCurrentTicks & 0x7F))
         {
-            peep->Update();
+            peep_update_guest(peep);
         }
         else
         {
@@ -214,7 +222,7 @@ void peep_update_all()
             // 128 tick can delete so double check its not deleted
             if (peep->Type == EntityType::Guest)
             {
-                peep->Update();
+                peep_update_guest(peep);
             }
         }
 
@@ -851,9 +859,62 @@ void Peep::UpdatePicked()
     }
 }
 
+/**
+ * The part of a guest that is advanced every tick before its state is updated. The result only depends on these
+ * fields, so the update can be worked out ahead of the guest loop.
+ */
+struct GuestTimers
+{
+    ride_id_t PreviousRide;
+    uint16_t PreviousRideTimeOut;
+    std::array<PeepThought, PEEP_MAX_THOUGHTS> Thoughts;
+
+    bool operator==(const GuestTimers& other) const
+    {
+        if (PreviousRide != other.PreviousRide || PreviousRideTimeOut != other.PreviousRideTimeOut)
+            return false;
+
+        for (size_t i = 0; i < Thoughts.size(); i++)
+        {
+            const auto& a = Thoughts[i];
+            const auto& b = other.Thoughts[i];
+            if (a.type != b.type || a.item != b.item || a.freshness != b.freshness || a.fresh_timeout != b.fresh_timeout)
+                return false;
+        }
+        return true;
+    }
+};
+
+struct GuestTimerUpdate
+{
+    uint16_t SpriteIndex;
+    GuestTimers Before;
+    GuestTimers After;
+    uint8_t InvalidateFlags;
+};
+
+static std::vector<GuestTimerUpdate> _guestTimerUpdates;
+// Position of each guest in _guestTimerUpdates, by sprite index
+static std::vector<uint32_t> _guestTimerUpdateIndices;
+
+static GuestTimers peep_get_guest_timers(const Guest* peep)
+{
+    return { peep->PreviousRide, peep->PreviousRideTimeOut, peep->Thoughts };
+}
+
+static void peep_set_guest_timers(Guest* peep, const GuestTimers& timers, uint8_t invalidateFlags)
+{
+    peep->PreviousRide = timers.PreviousRide;
+    peep->PreviousRideTimeOut = timers.PreviousRideTimeOut;
+    peep->Thoughts = timers.Thoughts;
+    peep->WindowInvalidateFlags |= invalidateFlags;
+}
+
 /* From peep_update */
-static void peep_update_thoughts(Guest* peep)
+static uint8_t peep_update_thoughts(GuestTimers& timers)
 {
+    uint8_t invalidateFlags = 0;
+
     // Thoughts must always have a gap of at least
     // 220 ticks in age between them. In order to
     // allow this when a thought is new it enters
@@ -862,37 +923,38 @@ static void peep_update_thoughts(Guest* peep)
     int32_t fresh_thought = -1;
     for (int32_t i = 0; i < PEEP_MAX_THOUGHTS; i++)
     {
-        if (peep->Thoughts[i].type == PeepThoughtType::None)
+        if (timers.Thoughts[i].type == PeepThoughtType::None)
             break;
 
-        if (peep->Thoughts[i].freshness == 1)
+        if (timers.Thoughts[i].freshness == 1)
         {
             add_fresh = 0;
             // If thought is fresh we wait 220 ticks
             // before allowing a new thought to become fresh.
-            if (++peep->Thoughts[i].fresh_timeout >= 220)
+            if (++timers.Thoughts[i].fresh_timeout >= 220)
             {
-                peep->Thoughts[i].fresh_timeout = 0;
+                timers.Thoughts[i].fresh_timeout = 0;
                 // Thought is no longer fresh
-                peep->Thoughts[i].freshness++;
+                timers.Thoughts[i].freshness++;
                 add_fresh = 1;
             }
         }
-        else if (peep->Thoughts[i].freshness > 1)
+        else if (timers.Thoughts[i].freshness > 1)
         {
-            if (++peep->Thoughts[i].fresh_timeout == 0)
+            if (++timers.Thoughts[i].fresh_timeout == 0)
             {
                 // When thought is older than ~6900 ticks remove it
-                if (++peep->Thoughts[i].freshness >= 28)
+                if (++timers.Thoughts[i].freshness >= 28)
                 {
-                    peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+                    invalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
 
                     // Clear top thought, push others up
                     if (i < PEEP_MAX_THOUGHTS - 2)
                     {
-                        memmove(&peep->Thoughts[i], &peep->Thoughts[i + 1], sizeof(PeepThought) * (PEEP_MAX_THOUGHTS - i - 1));
+                        memmove(
+                            &timers.Thoughts[i], &timers.Thoughts[i + 1], sizeof(PeepThought) * (PEEP_MAX_THOUGHTS - i - 1));
                     }
-                    peep->Thoughts[PEEP_MAX_THOUGHTS - 1].type = PeepThoughtType::None;
+                    timers.Thoughts[PEEP_MAX_THOUGHTS - 1].type = PeepThoughtType::None;
                 }
             }
         }
@@ -906,9 +968,80 @@ static void peep_update_thoughts(Guest* peep)
     // fresh.
     if (add_fresh && fresh_thought != -1)
     {
-        peep->Thoughts[fresh_thought].freshness = 1;
-        peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+        timers.Thoughts[fresh_thought].freshness = 1;
+        invalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+    }
+    return invalidateFlags;
+}
+
+static uint8_t peep_update_guest_timers(GuestTimers& timers)
+{
+    if (timers.PreviousRide != RIDE_ID_NULL)
+        if (++timers.PreviousRideTimeOut >= 720)
+            timers.PreviousRide = RIDE_ID_NULL;
+
+    return peep_update_thoughts(timers);
+}
+
+/**
+ * Advances the timers of every guest on the job pool. The guest loop takes the result for each guest whose timers were
+ * not changed in the meantime, and updates the others itself.
+ */
+static void peep_prepare_guest_timers()
+{
+    _guestTimerUpdates.clear();
+    if (GetEntityListCount(EntityType::Guest) < gGuestTimerParallelThreshold)
+        return;
+
+    _guestTimerUpdateIndices.resize(MAX_ENTITIES);
+    for (auto peep : EntityList<Guest>())
+    {
+        _guestTimerUpdateIndices[peep->sprite_index] = static_cast<uint32_t>(_guestTimerUpdates.size());
+        _guestTimerUpdates.push_back({ peep->sprite_index, {}, {}, 0 });
     }
+
+    auto updateGuest = [](size_t index) {
+        auto& update = _guestTimerUpdates[index];
+        update.Before = peep_get_guest_timers(GetEntity<Guest>(update.SpriteIndex));
+        update.After = update.Before;
+        update.InvalidateFlags = peep_update_guest_timers(update.After);
+    };
+    const size_t numWorkers = std::max<size_t>(1, JobPool::GetWorkerCount());
+    const size_t guestsPerTask = (_guestTimerUpdates.size() + numWorkers - 1) / numWorkers;
+    JobPool jobPool;
+    jobPool.ParallelFor(_guestTimerUpdates.size(), updateGuest, guestsPerTask);
+}
+
+static const GuestTimerUpdate* peep_get_prepared_guest_timers(const Guest* peep)
+{
+    if (_guestTimerUpdates.empty())
+        return nullptr;
+
+    auto index = _guestTimerUpdateIndices[peep->sprite_index];
+    if (index >= _guestTimerUpdates.size() || _guestTimerUpdates[index].SpriteIndex != peep->sprite_index)
+        return nullptr;
+
+    return &_guestTimerUpdates[index];
+}
+
+/**
+ * Same as Peep::Update() but takes the timers from peep_prepare_guest_timers() when they are still valid. They are only
+ * used when the guest's timers are unchanged since they were prepared, so the result is the same as updating them here.
+ */
+static void peep_update_guest(Guest* peep)
+{
+    auto timers = peep_get_guest_timers(peep);
+    auto* prepared = peep_get_prepared_guest_timers(peep);
+    if (prepared != nullptr && prepared->Before == timers)
+    {
+        peep_set_guest_timers(peep, prepared->After, prepared->InvalidateFlags);
+    }
+    else
+    {
+        auto invalidateFlags = peep_update_guest_timers(timers);
+        peep_set_guest_timers(peep, timers, invalidateFlags);
+    }
+    peep->UpdateStateAndMovement();
 }
 
 /**
@@ -920,12 +1053,16 @@ void Peep::Update()
     auto* guest = As<Guest>();
     if (guest != nullptr)
     {
-        if (guest->PreviousRide != RIDE_ID_NULL)
-            if (++guest->PreviousRideTimeOut >= 720)
-                guest->PreviousRide = RIDE_ID_NULL;
-
-        peep_update_thoughts(guest);
+        auto timers = peep_get_guest_timers(guest);
+        auto invalidateFlags = peep_update_guest_timers(timers);
+        peep_set_guest_timers(guest, timers, invalidateFlags);
     }
+    UpdateStateAndMovement();
+}
+
+void Peep::UpdateStateAndMovement()
+{
+    auto* guest = As<Guest>();
 
     // Walking speed logic
     uint32_t stepsToTake = Energy;
@@ -374,6 +374,7 @@ struct Peep : EntityBase
 
 public: // Peep
     void Update();
+    void UpdateStateAndMovement();
     std::optional<CoordsXY> UpdateAction(int16_t& xy_distance);
     std::optional<CoordsXY> UpdateAction();
     void SetState(PeepState new_state);
@@ -458,6 +459,9 @@ extern const bool gSpriteTypeToSlowWalkMap[48];
 
 extern uint8_t gPeepWarningThrottle[16];
 
+// Guest count from which the guest timers are advanced on the job pool ahead of the guest loop
+extern size_t gGuestTimerParallelThreshold;
+
 int32_t peep_get_staff_count();
 void peep_update_all();
 void peep_problem_warnings_update();
@@ -40,10 +40,12 @@
 #include "../world/Scenery.h"
 #include "../world/SmallScenery.h"
 #include "../world/Surface.h"
+#include "EntitySpatialQuery.h"
 #include "Peep.h"
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 
 // clang-format off
 const rct_string_id StaffCostumeNames[] = {
@@ -398,15 +400,30 @@ Direction Staff::HandymanDirectionToNearestLitter() const
 {
     uint16_t nearestLitterDist = 0xFFFF;
     Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>())
-    {
+    const auto checkLitter = [&](Litter* litter) {
         uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
 
-        if (distance < nearestLitterDist)
+        // Lowest sprite_index wins ties, matching the order of the entity list.
+        const bool isTie = distance == nearestLitterDist && nearestLitter != nullptr;
+        if (distance < nearestLitterDist || (isTie && litter->sprite_index < nearestLitter->sprite_index))
         {
             nearestLitterDist = distance;
             nearestLitter = litter;
         }
+    };
+
+    // The distance is truncated to 16 bits, on maps this large litter on the far side of the map can wrap around to a
+    // small distance so the whole list has to be checked to pick the same litter.
+    if (gMapSize * COORDS_XY_STEP * 2 + MAX_ELEMENT_HEIGHT * COORDS_Z_STEP * 4 > std::numeric_limits<uint16_t>::max())
+    {
+        for (auto litter : EntityList<Litter>())
+        {
+            checkLitter(litter);
+        }
+    }
+    else
+    {
+        ForEachEntityInRange<Litter>({ x, y }, MAX_LITTER_DISTANCE, checkLitter);
     }
 
     if (nearestLitterDist > MAX_LITTER_DISTANCE)
@@ -80,7 +80,7 @@ bool award_is_positive(AwardType type)
 #pragma region Award checks
 
 /** More than 1/16 of the total guests must be thinking untidy thoughts. */
-static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
+static bool award_is_deserved_most_untidy(int32_t activeAwardTypes, const GuestStatistics& guestStats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostBeautiful))
         return false;
@@ -89,60 +89,25 @@ static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostTidy))
         return false;
 
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
-    return (negativeCount > gNumGuestsInPark / 16);
+    return (guestStats.CountUntidyThoughts() > gNumGuestsInPark / 16);
 }
 
 /** More than 1/64 of the total guests must be thinking tidy thoughts and less than 6 guests thinking untidy thoughts. */
-static bool award_is_deserved_most_tidy(int32_t activeAwardTypes)
+static bool award_is_deserved_most_tidy(int32_t activeAwardTypes, const GuestStatistics& guestStats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostUntidy))
         return false;
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::VeryClean)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    auto positiveCount = guestStats.CountFreshThoughts(PeepThoughtType::VeryClean);
+    auto negativeCount = guestStats.CountUntidyThoughts();
     return (negativeCount <= 5 && positiveCount > gNumGuestsInPark / 64);
 }
 
 /** At least 6 open roller coasters. */
-static bool award_is_deserved_best_rollercoasters([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_rollercoasters(
+    [[maybe_unused]] int32_t activeAwardTypes, [[maybe_unused]] const GuestStatistics& guestStats)
 {
     auto rollerCoasters = 0;
     for (const auto& ride : GetRideManager())
@@ -169,7 +134,7 @@ static bool award_is_deserved_best_rollercoasters([[maybe_unused]] int32_t activ
 }
 
 /** Entrance fee is 0.10 less than half of the total ride value. */
-static bool award_is_deserved_best_value(int32_t activeAwardTypes)
+static bool award_is_deserved_best_value(int32_t activeAwardTypes, [[maybe_unused]] const GuestStatistics& guestStats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::WorstValue))
         return false;
@@ -190,40 +155,20 @@ static bool award_is_deserved_best_value(int32_t activeAwardTypes)
 }
 
 /** More than 1/128 of the total guests must be thinking scenic thoughts and fewer than 16 untidy thoughts. */
-static bool award_is_deserved_most_beautiful(int32_t activeAwardTypes)
+static bool award_is_deserved_most_beautiful(int32_t activeAwardTypes, const GuestStatistics& guestStats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostUntidy))
         return false;
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    auto list = EntityList<Guest>();
-    for (auto peep : list)
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::Scenery)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    auto positiveCount = guestStats.CountFreshThoughts(PeepThoughtType::Scenery);
+    auto negativeCount = guestStats.CountUntidyThoughts();
     return (negativeCount <= 15 && positiveCount > gNumGuestsInPark / 128);
 }
 
 /** Entrance fee is more than total ride value. */
-static bool award_is_deserved_worst_value(int32_t activeAwardTypes)
+static bool award_is_deserved_worst_value(int32_t activeAwardTypes, [[maybe_unused]] const GuestStatistics& guestStats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::BestValue))
         return false;
@@ -239,18 +184,9 @@ static bool award_is_deserved_worst_value(int32_t activeAwardTypes)
 }
 
 /** No more than 2 people who think the vandalism is bad and no crashes. */
-static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes, const GuestStatistics& guestStats)
 {
-    auto peepsWhoDislikeVandalism = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Vandalism)
-            peepsWhoDislikeVandalism++;
-    }
+    auto peepsWhoDislikeVandalism = guestStats.CountFreshThoughts(PeepThoughtType::Vandalism);
 
     if (peepsWhoDislikeVandalism > 2)
         return false;
@@ -268,7 +204,7 @@ static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes)
 }
 
 /** All staff types, at least 20 staff, one staff per 32 peeps. */
-static bool award_is_deserved_best_staff(int32_t activeAwardTypes)
+static bool award_is_deserved_best_staff(int32_t activeAwardTypes, [[maybe_unused]] const GuestStatistics& guestStats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostUntidy))
         return false;
@@ -280,7 +216,7 @@ static bool award_is_deserved_best_staff(int32_t activeAwardTypes)
 }
 
 /** At least 7 shops, 4 unique, one shop per 128 guests and no more than 12 hungry guests. */
-static bool award_is_deserved_best_food(int32_t activeAwardTypes)
+static bool award_is_deserved_best_food(int32_t activeAwardTypes, const GuestStatistics& guestStats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::WorstFood))
         return false;
@@ -311,21 +247,12 @@ static bool award_is_deserved_best_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = guestStats.CountFreshThoughts(PeepThoughtType::Hungry);
     return (hungryPeeps <= 12);
 }
 
 /** No more than 2 unique shops, less than one shop per 256 guests and more than 15 hungry guests. */
-static bool award_is_deserved_worst_food(int32_t activeAwardTypes)
+static bool award_is_deserved_worst_food(int32_t activeAwardTypes, const GuestStatistics& guestStats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::BestFood))
         return false;
@@ -356,21 +283,12 @@ static bool award_is_deserved_worst_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = guestStats.CountFreshThoughts(PeepThoughtType::Hungry);
     return (hungryPeeps > 15);
 }
 
 /** At least 4 restrooms, 1 restroom per 128 guests and no more than 16 guests who think they need the restroom. */
-static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwardTypes, const GuestStatistics& guestStats)
 {
     // Count open restrooms
     const auto& rideManager = GetRideManager();
@@ -387,21 +305,13 @@ static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwar
         return false;
 
     // Count number of guests who are thinking they need the restroom
-    auto guestsWhoNeedRestroom = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Toilet)
-            guestsWhoNeedRestroom++;
-    }
+    auto guestsWhoNeedRestroom = guestStats.CountFreshThoughts(PeepThoughtType::Toilet);
     return (guestsWhoNeedRestroom <= 16);
 }
 
 /** More than half of the rides have satisfaction <= 6 and park rating <= 650. */
-static bool award_is_deserved_most_disappointing(int32_t activeAwardTypes)
+static bool award_is_deserved_most_disappointing(
+    int32_t activeAwardTypes, [[maybe_unused]] const GuestStatistics& guestStats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::BestValue))
         return false;
@@ -428,7 +338,8 @@ static bool award_is_deserved_most_disappointing(int32_t activeAwardTypes)
 }
 
 /** At least 6 open water rides. */
-static bool award_is_deserved_best_water_rides([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_water_rides(
+    [[maybe_unused]] int32_t activeAwardTypes, [[maybe_unused]] const GuestStatistics& guestStats)
 {
     auto waterRides = 0;
     for (const auto& ride : GetRideManager())
@@ -456,7 +367,8 @@ static bool award_is_deserved_best_water_rides([[maybe_unused]] int32_t activeAw
 }
 
 /** At least 6 custom designed rides. */
-static bool award_is_deserved_best_custom_designed_rides(int32_t activeAwardTypes)
+static bool award_is_deserved_best_custom_designed_rides(
+    int32_t activeAwardTypes, [[maybe_unused]] const GuestStatistics& guestStats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
@@ -479,7 +391,8 @@ static bool award_is_deserved_best_custom_designed_rides(int32_t activeAwardType
     return (customDesignedRides >= 6);
 }
 
-static bool award_is_deserved_most_dazzling_ride_colours(int32_t activeAwardTypes)
+static bool award_is_deserved_most_dazzling_ride_colours(
+    int32_t activeAwardTypes, [[maybe_unused]] const GuestStatistics& guestStats)
 {
     /** At least 5 colourful rides and more than half of the rides are colourful. */
     static constexpr const colour_t dazzling_ride_colours[] = {
@@ -516,26 +429,18 @@ static bool award_is_deserved_most_dazzling_ride_colours(int32_t activeAwardType
 }
 
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
-static bool award_is_deserved_most_confusing_layout([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_most_confusing_layout(
+    [[maybe_unused]] int32_t activeAwardTypes, const GuestStatistics& guestStats)
 {
-    uint32_t peepsCounted = 0;
-    uint32_t peepsLost = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        peepsCounted++;
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && (thought.type == PeepThoughtType::Lost || thought.type == PeepThoughtType::CantFind))
-            peepsLost++;
-    }
-
+    auto peepsCounted = guestStats.GuestsInPark;
+    auto peepsLost = guestStats.CountFreshThoughts(PeepThoughtType::Lost)
+        + guestStats.CountFreshThoughts(PeepThoughtType::CantFind);
     return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
 }
 
 /** At least 10 open gentle rides. */
-static bool award_is_deserved_best_gentle_rides([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_gentle_rides(
+    [[maybe_unused]] int32_t activeAwardTypes, [[maybe_unused]] const GuestStatistics& guestStats)
 {
     auto gentleRides = 0;
     for (const auto& ride : GetRideManager())
@@ -562,7 +467,7 @@ static bool award_is_deserved_best_gentle_rides([[maybe_unused]] int32_t activeA
     return (gentleRides >= 10);
 }
 
-using award_deserved_check = bool (*)(int32_t);
+using award_deserved_check = bool (*)(int32_t, const GuestStatistics&);
 
 static constexpr const award_deserved_check _awardChecks[] = {
     award_is_deserved_most_untidy,
@@ -584,9 +489,9 @@ static constexpr const award_deserved_check _awardChecks[] = {
     award_is_deserved_best_gentle_rides,
 };
 
-static bool award_is_deserved(AwardType awardType, int32_t activeAwardTypes)
+static bool award_is_deserved(AwardType awardType, int32_t activeAwardTypes, const GuestStatistics& guestStats)
 {
-    return _awardChecks[EnumValue(awardType)](activeAwardTypes);
+    return _awardChecks[EnumValue(awardType)](activeAwardTypes, guestStats);
 }
 
 #pragma endregion
@@ -623,7 +528,8 @@ void award_update_all()
             } while (activeAwardTypes & (1 << EnumValue(awardType)));
 
             // Check if award is deserved
-            if (award_is_deserved(awardType, activeAwardTypes))
+            auto guestStats = GetGuestStatistics();
+            if (award_is_deserved(awardType, activeAwardTypes, guestStats))
             {
                 // Add award
                 _currentAwards.push_back(Award{ 5u, awardType });
@@ -33,16 +33,18 @@
 #include "../ui/WindowManager.h"
 #include "../util/SawyerCoding.h"
 #include "../world/Location.hpp"
+#include "NetworkMapDelta.h"
 #include "network.h"
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <stdexcept>
 
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "11"
+#define NETWORK_STREAM_VERSION "16"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -54,10 +56,23 @@ static int32_t _pickup_peep_old_x = LOCATION_NULL;
 // with uint16_t and needs some spare room for other data in the packet.
 static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 
+// Number of maps sent to clients that are kept as a delta base for reconnecting clients.
+static constexpr size_t MaxMapSnapshots = 3;
+
 // If data is sent fast enough it would halt the entire server, process only a maximum amount.
 // This limit is per connection, the current value was determined by tests with fuzzing.
 static constexpr uint32_t MaxPacketsPerUpdate = 100;
 
+// The game actions of a tick are sent in as few packets as possible, batches sent by the server are compressed once
+// they are large enough for it to pay off. MaxGameActionBatchSize only limits appending to a batch, a larger action is
+// sent in a batch of its own.
+static constexpr size_t MaxGameActionBatchSize = 1024 * 60;
+static constexpr size_t GameActionBatchCompressThreshold = 1024;
+// Every action of a batch counts towards MaxPacketsPerUpdate like a packet of its own.
+static constexpr size_t MaxGameActionsPerBatch = MaxPacketsPerUpdate;
+// A decompressed batch can not be larger than the packet it would have been sent in uncompressed.
+static constexpr size_t MaxGameActionBatchReadSize = std::numeric_limits<uint16_t>::max();
+
 #    include "../Cheats.h"
 #    include "../ParkImporter.h"
 #    include "../Version.h"
@@ -202,6 +217,8 @@ void NetworkBase::Close()
         _serverTickData.clear();
         _pendingPlayerLists.clear();
         _pendingPlayerInfo.clear();
+        _gameActionBatch.Clear();
+        _gameActionBatchCount = 0;
 
         gfx_invalidate_screen();
 
@@ -232,6 +249,7 @@ void NetworkBase::CloseConnection()
     }
     else if (mode == NETWORK_MODE_SERVER)
     {
+        _socketPoller.reset();
         _listenSocket.reset();
         _advertiser.reset();
     }
@@ -360,6 +378,8 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
     try
     {
         _listenSocket->Listen(address, port);
+        _socketPoller = CreateSocketPoller();
+        _socketPoller->Add(*_listenSocket, _listenSocket.get());
     }
     catch (const std::exception& ex)
     {
@@ -488,6 +508,8 @@ void NetworkBase::Update()
 
 void NetworkBase::Flush()
 {
+    SendGameActionBatch();
+
     if (GetMode() == NETWORK_MODE_CLIENT)
     {
         _serverConnection->SendQueuedPackets();
@@ -503,14 +525,37 @@ void NetworkBase::Flush()
 
 void NetworkBase::UpdateServer()
 {
-    for (auto& connection : client_connection_list)
+    // Only the sockets with pending data are read, idle connections do not cost a system call each update.
+    bool hasPendingClient = false;
+    _readySockets.clear();
+    _socketPoller->Poll(_readySockets, 0);
+    for (auto* tag : _readySockets)
     {
+        if (tag == _listenSocket.get())
+        {
+            hasPendingClient = true;
+            continue;
+        }
+
         // This can be called multiple times before the connection is removed.
+        auto& connection = *static_cast<NetworkConnection*>(tag);
+        if (connection.IsValid() && !ProcessConnection(connection))
+        {
+            connection.Disconnect();
+        }
+    }
+
+    for (auto& connection : client_connection_list)
+    {
         if (!connection->IsValid())
             continue;
 
-        if (!ProcessConnection(*connection))
+        if (!connection->ReceivedPacketRecently())
         {
+            if (!connection->GetLastDisconnectReason())
+            {
+                connection->SetLastDisconnectReason(STR_MULTIPLAYER_NO_DATA);
+            }
             connection->Disconnect();
         }
         else
@@ -531,10 +576,13 @@ void NetworkBase::UpdateServer()
         _advertiser->Update();
     }
 
-    std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
-    if (tcpSocket != nullptr)
+    if (hasPendingClient)
     {
-        AddClient(std::move(tcpSocket));
+        std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
+        if (tcpSocket != nullptr)
+        {
+            AddClient(std::move(tcpSocket));
+        }
     }
 }
 
@@ -716,6 +764,8 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromplayer, const char* text)
 
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd)
 {
+    // Serialise once, every connection queues the same buffer.
+    auto buffer = packet.Serialise();
     for (auto& client_connection : client_connection_list)
     {
         if (gameCmd)
@@ -729,8 +779,7 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        auto packetCopy = packet;
-        client_connection->QueuePacket(std::move(packetCopy), front);
+        client_connection->QueuePacket(buffer, front);
     }
 }
 
@@ -755,11 +804,19 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
 
     if (!storedTick.spriteHash.empty())
     {
-        EntitiesChecksum checksum = GetAllEntitiesChecksum();
-        std::string clientSpriteHash = checksum.ToString();
+        auto checksumTree = GetEntitiesChecksumTree();
+        std::string clientSpriteHash = checksumTree.Root.ToString();
         if (clientSpriteHash != storedTick.spriteHash)
         {
             log_info("Sprite hash mismatch, client = %s, server = %s", clientSpriteHash.c_str(), storedTick.spriteHash.c_str());
+            for (size_t i = 0; i < storedTick.spriteRangeHashes.size(); i++)
+            {
+                if (checksumTree.Ranges[i] != storedTick.spriteRangeHashes[i])
+                {
+                    const auto firstIndex = i * EntitiesChecksumTree::EntitiesPerRange;
+                    log_info("Entities %zu to %zu differ", firstIndex, firstIndex + EntitiesChecksumTree::EntitiesPerRange - 1);
+                }
+            }
             return false;
         }
     }
@@ -1242,6 +1299,11 @@ void NetworkBase::Client_Send_MAPREQUEST(const std::vector<ObjectEntryDescriptor
             packet.WriteString(name);
         }
     }
+    packet << static_cast<uint8_t>(_lastMapHash.has_value());
+    if (_lastMapHash.has_value())
+    {
+        packet.Write(_lastMapHash->data(), _lastMapHash->size());
+    }
     _serverConnection->QueuePacket(std::move(packet));
 }
 
@@ -1379,7 +1441,8 @@ void NetworkBase::Server_Send_AUTH(NetworkConnection& connection)
     }
 }
 
-void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
+void NetworkBase::Server_Send_MAP(
+    NetworkConnection* connection, const std::optional<Crypt::Sha1Algorithm::Result>& clientMapHash)
 {
     std::vector<const ObjectRepositoryItem*> objects;
     if (connection != nullptr)
@@ -1393,11 +1456,52 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         auto& context = GetContext();
         auto& objManager = context.GetObjectManager();
         objects = objManager.GetPackableObjects();
+
+        // A new park has been loaded.
+        _mapSnapshotGeneration++;
+    }
+
+    auto snapshot = GetMapSnapshot(objects);
+    if (snapshot == nullptr)
+    {
+        if (connection != nullptr)
+        {
+            connection->SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+            connection->Disconnect();
+        }
+        return;
+    }
+
+    // Send only what changed if the client still has a map we sent earlier. The delta is taken over the uncompressed
+    // park so that a changed byte only changes the delta locally, the payload is compressed afterwards.
+    auto encoding = NetworkMapEncoding::Full;
+    const std::vector<uint8_t>* payload = &snapshot->Data;
+    std::vector<uint8_t> delta;
+    if (clientMapHash.has_value())
+    {
+        auto base = std::find_if(_mapSnapshots.begin(), _mapSnapshots.end(), [&clientMapHash](const auto& s) {
+            return s->Hash == *clientMapHash;
+        });
+        if (base != _mapSnapshots.end())
+        {
+            delta = NetworkMapDelta::Encode((*base)->Data, snapshot->Data);
+            if (delta.size() < snapshot->Data.size())
+            {
+                log_verbose("Sending map delta of %zu bytes instead of %zu bytes", delta.size(), snapshot->Data.size());
+                encoding = NetworkMapEncoding::Delta;
+                payload = &delta;
+            }
+        }
     }
 
-    auto header = save_for_network(objects);
-    if (header.empty())
+    std::vector<uint8_t> compressed;
+    try
     {
+        compressed = Gzip(payload->data(), payload->size());
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Failed to compress map: %s", e.what());
         if (connection != nullptr)
         {
             connection->SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
@@ -1405,13 +1509,14 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         }
         return;
     }
+
     size_t chunksize = CHUNK_SIZE;
-    for (size_t i = 0; i < header.size(); i += chunksize)
+    for (size_t i = 0; i < compressed.size(); i += chunksize)
     {
-        size_t datasize = std::min(chunksize, header.size() - i);
+        size_t datasize = std::min(chunksize, compressed.size() - i);
         NetworkPacket packet(NetworkCommand::Map);
-        packet << static_cast<uint32_t>(header.size()) << static_cast<uint32_t>(i);
-        packet.Write(&header[i], datasize);
+        packet << static_cast<uint32_t>(compressed.size()) << static_cast<uint32_t>(i) << encoding;
+        packet.Write(&compressed[i], datasize);
         if (connection != nullptr)
         {
             connection->QueuePacket(std::move(packet));
@@ -1423,20 +1528,40 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
     }
 }
 
-std::vector<uint8_t> NetworkBase::save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const
+std::shared_ptr<const NetworkMapSnapshot> NetworkBase::GetMapSnapshot(
+    const std::vector<const ObjectRepositoryItem*>& objects)
 {
-    std::vector<uint8_t> result;
-    auto ms = OpenRCT2::MemoryStream();
-    if (SaveMap(&ms, objects))
+    // Clients joining in the same tick share the serialised map.
+    if (!_mapSnapshots.empty())
     {
-        result.resize(ms.GetLength());
-        std::memcpy(result.data(), ms.GetData(), result.size());
+        const auto& newest = _mapSnapshots.back();
+        if (newest->Tick == gCurrentTicks && newest->Generation == _mapSnapshotGeneration && newest->Objects == objects)
+        {
+            return newest;
+        }
     }
-    else
+
+    auto ms = OpenRCT2::MemoryStream();
+    if (!SaveMap(&ms, objects))
     {
         log_warning("Failed to export map.");
+        return nullptr;
     }
-    return result;
+
+    auto snapshot = std::make_shared<NetworkMapSnapshot>();
+    snapshot->Tick = gCurrentTicks;
+    snapshot->Generation = _mapSnapshotGeneration;
+    snapshot->Objects = objects;
+    const auto* data = static_cast<const uint8_t*>(ms.GetData());
+    snapshot->Data.assign(data, data + ms.GetLength());
+    snapshot->Hash = Crypt::SHA1(snapshot->Data.data(), snapshot->Data.size());
+
+    _mapSnapshots.push_back(snapshot);
+    if (_mapSnapshots.size() > MaxMapSnapshots)
+    {
+        _mapSnapshots.pop_front();
+    }
+    return snapshot;
 }
 
 void NetworkBase::Client_Send_CHAT(const char* text)
@@ -1471,8 +1596,6 @@ void NetworkBase::Server_Send_CHAT(const char* text, const std::vector<uint8_t>&
 
 void NetworkBase::Client_Send_GAME_ACTION(const GameAction* action)
 {
-    NetworkPacket packet(NetworkCommand::GameAction);
-
     uint32_t networkId = 0;
     networkId = ++_actionId;
 
@@ -1483,27 +1606,87 @@ void NetworkBase::Client_Send_GAME_ACTION(const GameAction* action)
         _gameActionCallbacks.insert(std::make_pair(networkId, action->GetCallback()));
     }
 
-    DataSerialiser stream(true);
-    action->Serialise(stream);
-
-    packet << gCurrentTicks << action->GetType() << stream;
-    _serverConnection->QueuePacket(std::move(packet));
+    QueueGameAction(action);
 }
 
 void NetworkBase::Server_Send_GAME_ACTION(const GameAction* action)
 {
-    NetworkPacket packet(NetworkCommand::GameAction);
+    QueueGameAction(action);
 
+    // Relayed actions have already been executed, a map serialised earlier in this tick no longer matches the park.
+    _mapSnapshotGeneration++;
+}
+
+/**
+ * Adds the action to the batch of the current tick, the batch is sent by Flush() or once it is full.
+ */
+void NetworkBase::QueueGameAction(const GameAction* action)
+{
     DataSerialiser stream(true);
     action->Serialise(stream);
+    const auto& actionData = stream.GetStream();
+    const auto actionSize = static_cast<size_t>(actionData.GetLength());
 
-    packet << gCurrentTicks << action->GetType() << stream;
+    // A batch only holds the actions of a single tick.
+    const auto entrySize = sizeof(GameCommand) + sizeof(uint32_t) + actionSize;
+    if (!_gameActionBatch.Data.empty()
+        && (_gameActionBatchTick != gCurrentTicks || _gameActionBatch.Data.size() + entrySize > MaxGameActionBatchSize
+            || _gameActionBatchCount >= MaxGameActionsPerBatch))
+    {
+        SendGameActionBatch();
+    }
 
-    SendPacketToClients(packet);
+    _gameActionBatchTick = gCurrentTicks;
+    _gameActionBatchCount++;
+    _gameActionBatch << action->GetType() << static_cast<uint32_t>(actionSize);
+    _gameActionBatch.Write(actionData.GetData(), actionSize);
+}
+
+void NetworkBase::SendGameActionBatch()
+{
+    if (_gameActionBatch.Data.empty())
+        return;
+
+    const auto& batch = _gameActionBatch.Data;
+    uint8_t flags = 0;
+    std::vector<uint8_t> compressed;
+    if (GetMode() == NETWORK_MODE_SERVER && batch.size() >= GameActionBatchCompressThreshold)
+    {
+        compressed = Gzip(batch.data(), batch.size());
+        if (compressed.size() < batch.size())
+        {
+            flags |= NETWORK_GAME_ACTION_BATCH_FLAG_GZIP;
+        }
+    }
+
+    NetworkPacket packet(NetworkCommand::GameAction);
+    packet << _gameActionBatchTick << flags;
+    if (flags & NETWORK_GAME_ACTION_BATCH_FLAG_GZIP)
+    {
+        packet.Write(compressed.data(), compressed.size());
+    }
+    else
+    {
+        packet.Write(batch.data(), batch.size());
+    }
+    _gameActionBatch.Clear();
+    _gameActionBatchCount = 0;
+
+    if (GetMode() == NETWORK_MODE_SERVER)
+    {
+        SendPacketToClients(packet);
+    }
+    else if (_serverConnection != nullptr)
+    {
+        _serverConnection->QueuePacket(packet);
+    }
 }
 
 void NetworkBase::Server_Send_TICK()
 {
+    // The actions of the previous tick have to arrive first.
+    SendGameActionBatch();
+
     NetworkPacket packet(NetworkCommand::Tick);
     packet << gCurrentTicks << scenario_rand_state().s0;
     uint32_t flags = 0;
@@ -1522,8 +1705,23 @@ void NetworkBase::Server_Send_TICK()
     packet << flags;
     if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
-        EntitiesChecksum checksum = GetAllEntitiesChecksum();
-        packet.WriteString(checksum.ToString().c_str());
+        auto checksumTree = GetEntitiesChecksumTree();
+        packet.WriteString(checksumTree.Root.ToString().c_str());
+
+        // The ranges with entities, so a desynchronised client can tell which entities diverged.
+        std::vector<std::pair<uint16_t, uint64_t>> ranges;
+        for (size_t i = 0; i < checksumTree.Ranges.size(); i++)
+        {
+            if (checksumTree.Ranges[i] != 0)
+            {
+                ranges.emplace_back(static_cast<uint16_t>(i), checksumTree.Ranges[i]);
+            }
+        }
+        packet << static_cast<uint16_t>(ranges.size());
+        for (const auto& [rangeIndex, rangeHash] : ranges)
+        {
+            packet << rangeIndex << rangeHash;
+        }
     }
 
     SendPacketToClients(packet);
@@ -1661,6 +1859,7 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
     NetworkReadPacket packetStatus;
 
     uint32_t countProcessed = 0;
+    _numGameActionsProcessed = 0;
     do
     {
         countProcessed++;
@@ -1689,7 +1888,8 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
                 // could not read anything from socket
                 break;
         }
-    } while (packetStatus == NetworkReadPacket::Success && countProcessed < MaxPacketsPerUpdate);
+    } while (packetStatus == NetworkReadPacket::Success
+             && countProcessed + _numGameActionsProcessed < MaxPacketsPerUpdate);
 
     if (!connection.ReceivedPacketRecently())
     {
@@ -1943,6 +2143,7 @@ void NetworkBase::ProcessDisconnectedClients()
         ServerClientDisconnected(connection);
         RemovePlayer(connection);
 
+        _socketPoller->Remove(*connection->Socket);
         it = client_connection_list.erase(it);
     }
 }
@@ -1958,6 +2159,7 @@ void NetworkBase::AddClient(std::unique_ptr<ITcpSocket>&& socket)
     auto connection = std::make_unique<NetworkConnection>();
     connection->Socket = std::move(socket);
 
+    _socketPoller->Add(*connection->Socket, connection.get());
     client_connection_list.push_back(std::move(connection));
 }
 
@@ -2536,8 +2738,21 @@ void NetworkBase::Server_Handle_MAPREQUEST(NetworkConnection& connection, Networ
         }
     }
 
+    std::optional<Crypt::Sha1Algorithm::Result> clientMapHash;
+    uint8_t hasClientMap{};
+    packet >> hasClientMap;
+    if (hasClientMap != 0)
+    {
+        const auto* hash = packet.Read(std::tuple_size_v<Crypt::Sha1Algorithm::Result>);
+        if (hash != nullptr)
+        {
+            clientMapHash.emplace();
+            std::copy_n(hash, clientMapHash->size(), clientMapHash->begin());
+        }
+    }
+
     auto player_name = connection.Player->Name.c_str();
-    Server_Send_MAP(&connection);
+    Server_Send_MAP(&connection, clientMapHash);
     Server_Send_EVENT_PLAYER_JOINED(player_name);
     Server_Send_GROUPLIST(connection);
 }
@@ -2672,7 +2887,8 @@ void NetworkBase::Server_Handle_AUTH(NetworkConnection& connection, NetworkPacke
 void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
 {
     uint32_t size, offset;
-    packet >> size >> offset;
+    NetworkMapEncoding encoding;
+    packet >> size >> offset >> encoding;
     int32_t chunksize = static_cast<int32_t>(packet.Header.Size - packet.BytesRead);
     if (chunksize <= 0)
     {
@@ -2711,12 +2927,31 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
         GameActions::ResumeQueue();
 
         context_force_close_window_by_class(WC_NETWORK_STATUS);
-        bool has_to_free = false;
-        uint8_t* data = &chunk_buffer[0];
-        size_t data_size = size;
-        auto ms = MemoryStream(data, data_size);
-        if (LoadMap(&ms))
+        std::vector<uint8_t> mapData;
+        try
         {
+            auto payload = Ungzip(chunk_buffer.data(), size);
+            if (encoding == NetworkMapEncoding::Delta)
+            {
+                mapData = NetworkMapDelta::Decode(_lastMap, payload.data(), payload.size());
+            }
+            else
+            {
+                mapData = std::move(payload);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to decode map from server: %s", e.what());
+            mapData.clear();
+        }
+
+        auto ms = MemoryStream(mapData.data(), mapData.size());
+        if (!mapData.empty() && LoadMap(&ms))
+        {
+            _lastMapHash = Crypt::SHA1(mapData.data(), mapData.size());
+            _lastMap = std::move(mapData);
+
             game_load_init();
             game_load_scripts();
             _serverState.tick = gCurrentTicks;
@@ -2742,10 +2977,6 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
             auto loadOrQuitAction = LoadOrQuitAction(LoadOrQuitModes::OpenSavePrompt, PromptMode::SaveBeforeQuit);
             GameActions::Execute(&loadOrQuitAction);
         }
-        if (has_to_free)
-        {
-            free(data);
-        }
     }
 }
 
@@ -2782,6 +3013,8 @@ bool NetworkBase::SaveMap(IStream* stream, const std::vector<const ObjectReposit
     {
         auto exporter = std::make_unique<ParkFileExporter>();
         exporter->ExportObjectsList = objects;
+        // Server_Send_MAP compresses the map, or the delta against an earlier map, as a whole.
+        exporter->Uncompressed = true;
         exporter->Export(*stream);
         result = true;
     }
@@ -2867,112 +3100,172 @@ void NetworkBase::Server_Handle_CHAT(NetworkConnection& connection, NetworkPacke
     Server_Send_CHAT(formatted);
 }
 
-void NetworkBase::Client_Handle_GAME_ACTION([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+/**
+ * Reads the actions of a batch, returns false if the batch is malformed. Malformed batches are dropped as a whole, no
+ * action of them is executed.
+ */
+static bool ReadGameActionBatch(
+    NetworkPacket& packet, bool allowCompressed, uint32_t& tick, std::vector<GameAction::Ptr>& actions)
 {
-    uint32_t tick;
-    GameCommand actionType;
-    packet >> tick >> actionType;
+    uint8_t flags{};
+    packet >> tick >> flags;
 
-    MemoryStream stream;
     const size_t size = packet.Header.Size - packet.BytesRead;
-    stream.WriteArray(packet.Read(size), size);
-    stream.SetPosition(0);
+    const auto* data = packet.Read(size);
+    if (data == nullptr)
+        return false;
+
+    NetworkPacket batch;
+    if (flags & NETWORK_GAME_ACTION_BATCH_FLAG_GZIP)
+    {
+        if (!allowCompressed)
+            return false;
+        try
+        {
+            batch.Data = Ungzip(data, size);
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        batch.Data.assign(data, data + size);
+    }
+    if (batch.Data.size() > MaxGameActionBatchReadSize)
+        return false;
+    batch.Header.Size = static_cast<uint16_t>(batch.Data.size());
+
+    while (batch.BytesRead < batch.Data.size())
+    {
+        if (actions.size() >= MaxGameActionsPerBatch)
+            return false;
+        if (batch.Data.size() - batch.BytesRead < sizeof(GameCommand) + sizeof(uint32_t))
+            return false;
+
+        GameCommand actionType;
+        uint32_t actionSize;
+        batch >> actionType >> actionSize;
+        const auto* actionData = batch.Read(actionSize);
+        if (actionData == nullptr)
+            return false;
+
+        GameAction::Ptr action = GameActions::Create(actionType);
+        if (action == nullptr)
+        {
+            log_error("Received unregistered game action type: 0x%08X", actionType);
+            return false;
+        }
 
-    DataSerialiser ds(false, stream);
+        DataSerialiser stream(false);
+        stream.GetStream().WriteArray(actionData, actionSize);
+        stream.GetStream().SetPosition(0);
+        try
+        {
+            action->Serialise(stream);
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+        actions.push_back(std::move(action));
+    }
+    return true;
+}
 
-    GameAction::Ptr action = GameActions::Create(actionType);
-    if (action == nullptr)
+void NetworkBase::Client_Handle_GAME_ACTION([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t tick{};
+    std::vector<GameAction::Ptr> actions;
+    if (!ReadGameActionBatch(packet, true, tick, actions))
     {
-        log_error("Received unregistered game action type: 0x%08X", actionType);
+        log_error("Received malformed game action batch.");
         return;
     }
-    action->Serialise(ds);
 
-    if (player_id == action->GetPlayer().id)
+    for (auto& action : actions)
     {
-        // Only execute callbacks that belong to us,
-        // clients can have identical network ids assigned.
-        auto itr = _gameActionCallbacks.find(action->GetNetworkId());
-        if (itr != _gameActionCallbacks.end())
+        if (player_id == action->GetPlayer().id)
         {
-            action->SetCallback(itr->second);
-            _gameActionCallbacks.erase(itr);
+            // Only execute callbacks that belong to us,
+            // clients can have identical network ids assigned.
+            auto itr = _gameActionCallbacks.find(action->GetNetworkId());
+            if (itr != _gameActionCallbacks.end())
+            {
+                action->SetCallback(itr->second);
+                _gameActionCallbacks.erase(itr);
+            }
         }
-    }
 
-    GameActions::Enqueue(std::move(action), tick);
+        GameActions::Enqueue(std::move(action), tick);
+    }
 }
 
 void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet)
 {
-    uint32_t tick;
-    GameCommand actionType;
-
     NetworkPlayer* player = connection.Player;
     if (player == nullptr)
     {
         return;
     }
 
-    packet >> tick >> actionType;
-
-    // Don't let clients send pause or quit
-    if (actionType == GameCommand::TogglePause || actionType == GameCommand::LoadOrQuit)
+    // Clients never compress their batches, inflating untrusted data is not worth the risk.
+    uint32_t tick{};
+    std::vector<GameAction::Ptr> actions;
+    if (!ReadGameActionBatch(packet, false, tick, actions))
     {
+        log_warning("Received malformed game action batch from player: (%d) %s", player->Id, player->Name.c_str());
         return;
     }
+    _numGameActionsProcessed += static_cast<uint32_t>(actions.size());
 
-    if (actionType != GameCommand::Custom)
+    for (auto& ga : actions)
     {
-        // Check if player's group permission allows command to run
-        NetworkGroup* group = GetGroupByID(connection.Player->Group);
-        if (group == nullptr || group->CanPerformCommand(actionType) == false)
+        const auto actionType = ga->GetType();
+
+        // Don't let clients send pause or quit
+        if (actionType == GameCommand::TogglePause || actionType == GameCommand::LoadOrQuit)
         {
-            Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_PERMISSION_DENIED);
-            return;
+            continue;
         }
-    }
-
-    // Create and enqueue the action.
-    GameAction::Ptr ga = GameActions::Create(actionType);
-    if (ga == nullptr)
-    {
-        log_error(
-            "Received unregistered game action type: 0x%08X from player: (%d) %s", actionType, connection.Player->Id,
-            connection.Player->Name.c_str());
-        return;
-    }
 
-    // Player who is hosting is not affected by cooldowns.
-    if ((player->Flags & NETWORK_PLAYER_FLAG_ISSERVER) == 0)
-    {
-        auto cooldownIt = player->CooldownTime.find(actionType);
-        if (cooldownIt != std::end(player->CooldownTime))
+        if (actionType != GameCommand::Custom)
         {
-            if (cooldownIt->second > 0)
+            // Check if player's group permission allows command to run
+            NetworkGroup* group = GetGroupByID(connection.Player->Group);
+            if (group == nullptr || group->CanPerformCommand(actionType) == false)
             {
-                Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_NETWORK_ACTION_RATE_LIMIT_MESSAGE);
-                return;
+                Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_PERMISSION_DENIED);
+                continue;
             }
         }
 
-        uint32_t cooldownTime = ga->GetCooldownTime();
-        if (cooldownTime > 0)
+        // Player who is hosting is not affected by cooldowns.
+        if ((player->Flags & NETWORK_PLAYER_FLAG_ISSERVER) == 0)
         {
-            player->CooldownTime[actionType] = cooldownTime;
-        }
-    }
+            auto cooldownIt = player->CooldownTime.find(actionType);
+            if (cooldownIt != std::end(player->CooldownTime))
+            {
+                if (cooldownIt->second > 0)
+                {
+                    Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_NETWORK_ACTION_RATE_LIMIT_MESSAGE);
+                    continue;
+                }
+            }
 
-    DataSerialiser stream(false);
-    const size_t size = packet.Header.Size - packet.BytesRead;
-    stream.GetStream().WriteArray(packet.Read(size), size);
-    stream.GetStream().SetPosition(0);
+            uint32_t cooldownTime = ga->GetCooldownTime();
+            if (cooldownTime > 0)
+            {
+                player->CooldownTime[actionType] = cooldownTime;
+            }
+        }
 
-    ga->Serialise(stream);
-    // Set player to sender, should be 0 if sent from client.
-    ga->SetPlayer(NetworkPlayerId_t{ connection.Player->Id });
+        // Set player to sender, should be 0 if sent from client.
+        ga->SetPlayer(NetworkPlayerId_t{ connection.Player->Id });
 
-    GameActions::Enqueue(std::move(ga), tick);
+        GameActions::Enqueue(std::move(ga), tick);
+    }
 }
 
 void NetworkBase::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
@@ -2994,6 +3287,20 @@ void NetworkBase::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connect
         {
             tickData.spriteHash = text;
         }
+
+        uint16_t numRanges{};
+        packet >> numRanges;
+        tickData.spriteRangeHashes.resize(EntitiesChecksumTree::NumRanges);
+        for (uint16_t i = 0; i < numRanges; i++)
+        {
+            uint16_t rangeIndex{};
+            uint64_t rangeHash{};
+            packet >> rangeIndex >> rangeHash;
+            if (rangeIndex < tickData.spriteRangeHashes.size())
+            {
+                tickData.spriteRangeHashes[rangeIndex] = rangeHash;
+            }
+        }
     }
 
     // Don't let the history grow too much.
@@ -2,6 +2,7 @@
 
 #include "../System.hpp"
 #include "../actions/GameAction.h"
+#include "../core/Crypt.h"
 #include "../object/Object.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
@@ -10,7 +11,9 @@
 #include "NetworkTypes.h"
 #include "NetworkUser.h"
 
+#include <deque>
 #include <fstream>
+#include <optional>
 
 #ifndef DISABLE_NETWORK
 
@@ -19,6 +22,15 @@ namespace OpenRCT2
     struct IContext;
 }
 
+struct NetworkMapSnapshot
+{
+    uint32_t Tick;
+    uint32_t Generation;
+    std::vector<const ObjectRepositoryItem*> Objects;
+    std::vector<uint8_t> Data;
+    Crypt::Sha1Algorithm::Result Hash;
+};
+
 class NetworkBase : public OpenRCT2::System
 {
 public:
@@ -76,15 +88,18 @@ public: // Server
     void UpdateServer();
     void ServerClientDisconnected(std::unique_ptr<NetworkConnection>& connection);
     bool SaveMap(OpenRCT2::IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const;
-    std::vector<uint8_t> save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const;
+    std::shared_ptr<const NetworkMapSnapshot> GetMapSnapshot(const std::vector<const ObjectRepositoryItem*>& objects);
     std::string MakePlayerNameUnique(const std::string& name);
 
     // Packet dispatchers.
     void Server_Send_AUTH(NetworkConnection& connection);
     void Server_Send_TOKEN(NetworkConnection& connection);
-    void Server_Send_MAP(NetworkConnection* connection = nullptr);
+    void Server_Send_MAP(
+        NetworkConnection* connection = nullptr, const std::optional<Crypt::Sha1Algorithm::Result>& clientMapHash = {});
     void Server_Send_CHAT(const char* text, const std::vector<uint8_t>& playerIds = {});
     void Server_Send_GAME_ACTION(const GameAction* action);
+    void QueueGameAction(const GameAction* action);
+    void SendGameActionBatch();
     void Server_Send_TICK();
     void Server_Send_PLAYERINFO(int32_t playerId);
     void Server_Send_PLAYERLIST();
@@ -190,9 +205,18 @@ private: // Common Data
     bool _requireClose = false;
     bool wsa_initialized = false;
 
+    // The game actions of the current tick that have not been sent yet, see QueueGameAction().
+    NetworkPacket _gameActionBatch;
+    uint32_t _gameActionBatchTick = 0;
+    size_t _gameActionBatchCount = 0;
+    // Game actions received from the connection being processed, they count towards the packets read per update.
+    uint32_t _numGameActionsProcessed = 0;
+
 private: // Server Data
     std::unordered_map<NetworkCommand, CommandHandler> server_command_handlers;
     std::unique_ptr<ITcpSocket> _listenSocket;
+    std::unique_ptr<ISocketPoller> _socketPoller;
+    std::vector<void*> _readySockets;
     std::unique_ptr<INetworkServerAdvertiser> _advertiser;
     std::list<std::unique_ptr<NetworkConnection>> client_connection_list;
     std::string _serverLogPath;
@@ -201,6 +225,12 @@ private: // Server Data
     uint16_t listening_port = 0;
     bool _playerListInvalidated = false;
 
+    // The maps recently sent to clients, the newest one is shared by clients joining in the same tick and the others
+    // are kept as the base of a delta for clients that reconnect.
+    std::deque<std::shared_ptr<const NetworkMapSnapshot>> _mapSnapshots;
+    // Changed by anything that modifies the park outside of the game tick, invalidates the newest snapshot.
+    uint32_t _mapSnapshotGeneration = 0;
+
 private: // Client Data
     struct PlayerListUpdate
     {
@@ -212,6 +242,8 @@ private: // Client Data
         uint32_t srand0;
         uint32_t tick;
         std::string spriteHash;
+        // Hashes of the entity index ranges the server sent with spriteHash, see EntitiesChecksumTree.
+        std::vector<uint64_t> spriteRangeHashes;
     };
 
     std::unordered_map<NetworkCommand, CommandHandler> client_command_handlers;
@@ -220,6 +252,9 @@ private: // Client Data
     std::multimap<uint32_t, NetworkPlayer> _pendingPlayerInfo;
     std::map<uint32_t, ServerTickData_t> _serverTickData;
     std::vector<ObjectEntryDescriptor> _missingObjects;
+    // The last map loaded from a server, sent back as a delta base when connecting again.
+    std::vector<uint8_t> _lastMap;
+    std::optional<Crypt::Sha1Algorithm::Result> _lastMapHash;
     std::string _host;
     std::string _chatLogPath;
     std::string _chatLogFilenameFormat = "%Y%m%d-%H%M%S.txt";
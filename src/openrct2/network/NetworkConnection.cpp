@@ -17,8 +17,12 @@
 #    include "Socket.h"
 #    include "network.h"
 
+#    include <algorithm>
+#    include <array>
+
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
 constexpr size_t NetworkBufferSize = 1024 * 64; // 64 KiB, maximum packet size.
+constexpr size_t MaxPacketsPerSend = 64;
 
 NetworkConnection::NetworkConnection()
 {
@@ -89,7 +93,7 @@ NetworkReadPacket NetworkConnection::ReadPacket()
             // Received complete packet.
             _lastPacketTime = platform_get_ticks();
 
-            RecordPacketStats(InboundPacket, false);
+            RecordPacketStats(InboundPacket.GetCommand(), InboundPacket.BytesTransferred, false);
 
             return NetworkReadPacket::Success;
         }
@@ -98,42 +102,18 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+void NetworkConnection::QueuePacket(const NetworkPacket& packet, bool front)
 {
-    auto header = packet.Header;
-
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
-
-    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
-    // Previously the Id field was not part of the header rather part of the body.
-    header.Size += sizeof(header.Id);
-    header.Size = Convert::HostToNetwork(header.Size);
-    header.Id = ByteSwapBE(header.Id);
-
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
-
-    size_t bufferSize = buffer.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
-    if (sent > 0)
-    {
-        packet.BytesTransferred += sent;
-    }
-
-    bool sendComplete = packet.BytesTransferred == buffer.size();
-    if (sendComplete)
+    if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
-        RecordPacketStats(packet, true);
+        QueuePacket(packet.Serialise(), front);
     }
-    return sendComplete;
 }
 
-void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
+void NetworkConnection::QueuePacket(NetworkPacketBuffer buffer, bool front)
 {
-    if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
+    if (AuthStatus == NetworkAuth::Ok || !buffer.CommandRequiresAuth())
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
         if (front)
         {
             // If the first packet was already partially sent add new packet to second position
@@ -141,16 +121,16 @@ void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
             {
                 auto it = _outboundPackets.begin();
                 it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
+                _outboundPackets.insert(it, OutboundPacket{ std::move(buffer) });
             }
             else
             {
-                _outboundPackets.push_front(std::move(packet));
+                _outboundPackets.push_front(OutboundPacket{ std::move(buffer) });
             }
         }
         else
         {
-            _outboundPackets.push_back(std::move(packet));
+            _outboundPackets.push_back(OutboundPacket{ std::move(buffer) });
         }
     }
 }
@@ -167,9 +147,40 @@ bool NetworkConnection::IsValid() const
 
 void NetworkConnection::SendQueuedPackets()
 {
-    while (!_outboundPackets.empty() && SendPacket(_outboundPackets.front()))
+    while (!_outboundPackets.empty())
     {
-        _outboundPackets.pop_front();
+        // Hand as many queued packets to the socket as possible in a single call.
+        std::array<SocketBuffer, MaxPacketsPerSend> buffers;
+        size_t numBuffers = 0;
+        size_t bufferedSize = 0;
+        for (auto it = _outboundPackets.begin(); it != _outboundPackets.end() && numBuffers < buffers.size(); it++)
+        {
+            const auto& bytes = *it->Buffer.Bytes;
+            buffers[numBuffers++] = { bytes.data() + it->BytesTransferred, bytes.size() - it->BytesTransferred };
+            bufferedSize += bytes.size() - it->BytesTransferred;
+        }
+
+        const size_t sent = Socket->SendData(buffers.data(), numBuffers);
+        size_t remaining = sent;
+        while (remaining > 0)
+        {
+            auto& packet = _outboundPackets.front();
+            const auto packetSize = packet.Buffer.Bytes->size();
+            const auto packetSent = std::min(remaining, packetSize - packet.BytesTransferred);
+            packet.BytesTransferred += packetSent;
+            remaining -= packetSent;
+            if (packet.BytesTransferred == packetSize)
+            {
+                RecordPacketStats(packet.Buffer.Command, packetSize, true);
+                _outboundPackets.pop_front();
+            }
+        }
+
+        if (sent != bufferedSize)
+        {
+            // The socket can not take more right now.
+            break;
+        }
     }
 }
 
@@ -206,12 +217,11 @@ void NetworkConnection::SetLastDisconnectReason(const rct_string_id string_id, v
     SetLastDisconnectReason(buffer);
 }
 
-void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
+void NetworkConnection::RecordPacketStats(NetworkCommand command, size_t packetSize, bool sending)
 {
-    uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
     NetworkStatisticsGroup trafficGroup;
 
-    switch (packet.GetCommand())
+    switch (command)
     {
         case NetworkCommand::GameAction:
             trafficGroup = NetworkStatisticsGroup::Commands;
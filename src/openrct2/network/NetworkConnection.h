@@ -42,12 +42,9 @@ public:
     ~NetworkConnection();
 
     NetworkReadPacket ReadPacket();
-    void QueuePacket(NetworkPacket&& packet, bool front = false);
-    void QueuePacket(const NetworkPacket& packet, bool front = false)
-    {
-        auto copy = packet;
-        return QueuePacket(std::move(copy), front);
-    }
+    void QueuePacket(const NetworkPacket& packet, bool front = false);
+    // Queues an already serialised packet, used to share one buffer between all connections a packet is sent to.
+    void QueuePacket(NetworkPacketBuffer buffer, bool front = false);
 
     // This will not immediately disconnect the client. The disconnect
     // will happen post-tick.
@@ -63,12 +60,17 @@ public:
     void SetLastDisconnectReason(const rct_string_id string_id, void* args = nullptr);
 
 private:
-    std::deque<NetworkPacket> _outboundPackets;
+    struct OutboundPacket
+    {
+        NetworkPacketBuffer Buffer;
+        size_t BytesTransferred = 0;
+    };
+
+    std::deque<OutboundPacket> _outboundPackets;
     uint32_t _lastPacketTime = 0;
     std::string _lastDisconnectReason;
 
-    void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    void RecordPacketStats(NetworkCommand command, size_t packetSize, bool sending);
 };
 
 #endif // DISABLE_NETWORK
@@ -0,0 +1,183 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkMapDelta.h"
+
+#    include "../core/MemoryStream.h"
+
+#    include <algorithm>
+#    include <cstring>
+#    include <stdexcept>
+#    include <unordered_map>
+
+using namespace OpenRCT2;
+
+namespace NetworkMapDelta
+{
+    // Matches shorter than the window are sent as inserted bytes.
+    static constexpr size_t WindowSize = 64;
+    static constexpr uint32_t HashMultiplier = 0x01000193;
+
+    enum class DeltaOp : uint8_t
+    {
+        Copy,
+        Insert,
+    };
+
+    static uint32_t HashWindow(const uint8_t* data)
+    {
+        uint32_t hash = 0;
+        for (size_t i = 0; i < WindowSize; i++)
+        {
+            hash = hash * HashMultiplier + data[i];
+        }
+        return hash;
+    }
+
+    static void WriteCopy(MemoryStream& ms, size_t baseOffset, size_t length)
+    {
+        ms.WriteValue(DeltaOp::Copy);
+        ms.WriteValue(static_cast<uint32_t>(baseOffset));
+        ms.WriteValue(static_cast<uint32_t>(length));
+    }
+
+    static void WriteInsert(MemoryStream& ms, const uint8_t* data, size_t length)
+    {
+        ms.WriteValue(DeltaOp::Insert);
+        ms.WriteValue(static_cast<uint32_t>(length));
+        ms.Write(data, length);
+    }
+
+    std::vector<uint8_t> Encode(const std::vector<uint8_t>& base, const std::vector<uint8_t>& target)
+    {
+        // Index the aligned windows of base, the target is then scanned with a rolling hash at every offset.
+        std::unordered_map<uint32_t, size_t> windows;
+        windows.reserve(base.size() / WindowSize);
+        for (size_t offset = 0; offset + WindowSize <= base.size(); offset += WindowSize)
+        {
+            windows.emplace(HashWindow(&base[offset]), offset);
+        }
+
+        uint32_t outgoingFactor = 1;
+        for (size_t i = 0; i < WindowSize; i++)
+        {
+            outgoingFactor *= HashMultiplier;
+        }
+
+        MemoryStream ms;
+        ms.WriteValue(static_cast<uint32_t>(target.size()));
+
+        size_t insertStart = 0;
+        size_t pos = 0;
+        uint32_t hash = 0;
+        bool hashValid = false;
+        while (pos + WindowSize <= target.size())
+        {
+            if (!hashValid)
+            {
+                hash = HashWindow(&target[pos]);
+                hashValid = true;
+            }
+
+            auto it = windows.find(hash);
+            if (it == windows.end() || std::memcmp(&base[it->second], &target[pos], WindowSize) != 0)
+            {
+                if (pos + WindowSize < target.size())
+                {
+                    hash = hash * HashMultiplier + target[pos + WindowSize] - target[pos] * outgoingFactor;
+                }
+                pos++;
+                continue;
+            }
+
+            // Grow the match in both directions, backwards only over bytes that have not been written yet.
+            size_t baseOffset = it->second;
+            size_t length = WindowSize;
+            while (baseOffset + length < base.size() && pos + length < target.size()
+                   && base[baseOffset + length] == target[pos + length])
+            {
+                length++;
+            }
+            while (pos > insertStart && baseOffset > 0 && base[baseOffset - 1] == target[pos - 1])
+            {
+                pos--;
+                baseOffset--;
+                length++;
+            }
+
+            if (pos > insertStart)
+            {
+                WriteInsert(ms, &target[insertStart], pos - insertStart);
+            }
+            WriteCopy(ms, baseOffset, length);
+            pos += length;
+            insertStart = pos;
+            hashValid = false;
+        }
+        if (insertStart < target.size())
+        {
+            WriteInsert(ms, &target[insertStart], target.size() - insertStart);
+        }
+
+        const auto* data = static_cast<const uint8_t*>(ms.GetData());
+        return std::vector<uint8_t>(data, data + ms.GetLength());
+    }
+
+    std::vector<uint8_t> Decode(const std::vector<uint8_t>& base, const uint8_t* delta, size_t deltaLength)
+    {
+        MemoryStream ms(delta, deltaLength);
+        const auto targetSize = ms.ReadValue<uint32_t>();
+
+        std::vector<uint8_t> result;
+        result.reserve(std::min<size_t>(targetSize, base.size() + deltaLength));
+        while (ms.GetPosition() < ms.GetLength())
+        {
+            const auto op = ms.ReadValue<DeltaOp>();
+            if (op == DeltaOp::Copy)
+            {
+                const size_t baseOffset = ms.ReadValue<uint32_t>();
+                const size_t length = ms.ReadValue<uint32_t>();
+                if (baseOffset > base.size() || length > base.size() - baseOffset)
+                {
+                    throw std::runtime_error("Map delta copies past the end of the base map.");
+                }
+                result.insert(result.end(), base.begin() + baseOffset, base.begin() + baseOffset + length);
+            }
+            else if (op == DeltaOp::Insert)
+            {
+                const size_t length = ms.ReadValue<uint32_t>();
+                if (length > ms.GetLength() - ms.GetPosition())
+                {
+                    throw std::runtime_error("Map delta is truncated.");
+                }
+                const auto* data = delta + ms.GetPosition();
+                result.insert(result.end(), data, data + length);
+                ms.SetPosition(ms.GetPosition() + length);
+            }
+            else
+            {
+                throw std::runtime_error("Unknown map delta operation.");
+            }
+
+            if (result.size() > targetSize)
+            {
+                throw std::runtime_error("Map delta exceeds the map size.");
+            }
+        }
+        if (result.size() != targetSize)
+        {
+            throw std::runtime_error("Map delta does not match the map size.");
+        }
+        return result;
+    }
+} // namespace NetworkMapDelta
+
+#endif
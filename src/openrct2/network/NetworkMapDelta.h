@@ -0,0 +1,39 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <vector>
+
+/**
+ * How the payload of the NetworkCommand::Map packets is encoded.
+ */
+enum class NetworkMapEncoding : uint8_t
+{
+    // The serialised park.
+    Full,
+    // A delta against the last map the client loaded, see NetworkMapDelta.
+    Delta,
+};
+
+namespace NetworkMapDelta
+{
+    /**
+     * Encodes target as a sequence of copies from base and inserted bytes. Runs of bytes that did not change between base
+     * and target are found even if they moved, base and target should be uncompressed park files.
+     */
+    std::vector<uint8_t> Encode(const std::vector<uint8_t>& base, const std::vector<uint8_t>& target);
+
+    /**
+     * Reconstructs the target from base and a delta created by Encode(), throws if the delta is invalid for base.
+     */
+    std::vector<uint8_t> Decode(const std::vector<uint8_t>& base, const uint8_t* delta, size_t deltaLength);
+} // namespace NetworkMapDelta
@@ -12,8 +12,90 @@
 #    include "NetworkPacket.h"
 
 #    include "NetworkTypes.h"
+#    include "Socket.h"
 
 #    include <memory>
+#    include <mutex>
+
+// Serialised packets up to this size are kept for reuse, these are the ones sent every tick.
+static constexpr size_t MaxPooledBufferSize = 4096;
+static constexpr size_t MaxPooledBuffers = 256;
+
+/**
+ * Keeps the memory of serialised packets once every connection has sent them, so broadcasting a packet each tick does
+ * not allocate.
+ */
+class NetworkPacketBufferPool
+{
+private:
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<std::vector<uint8_t>>> _buffers;
+
+public:
+    static NetworkPacketBufferPool& Get()
+    {
+        static NetworkPacketBufferPool pool;
+        return pool;
+    }
+
+    std::shared_ptr<std::vector<uint8_t>> Allocate(size_t size)
+    {
+        std::unique_ptr<std::vector<uint8_t>> buffer;
+        if (size <= MaxPooledBufferSize)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_buffers.empty())
+            {
+                buffer = std::move(_buffers.back());
+                _buffers.pop_back();
+            }
+        }
+        if (buffer == nullptr)
+        {
+            buffer = std::make_unique<std::vector<uint8_t>>();
+        }
+        buffer->reserve(size);
+        return std::shared_ptr<std::vector<uint8_t>>(buffer.release(), [this](std::vector<uint8_t>* b) { Release(b); });
+    }
+
+private:
+    void Release(std::vector<uint8_t>* buffer)
+    {
+        std::unique_ptr<std::vector<uint8_t>> owned(buffer);
+        if (owned->capacity() <= MaxPooledBufferSize)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_buffers.size() < MaxPooledBuffers)
+            {
+                owned->clear();
+                _buffers.push_back(std::move(owned));
+            }
+        }
+    }
+};
+
+static bool CommandRequiresAuth(NetworkCommand command)
+{
+    switch (command)
+    {
+        case NetworkCommand::Ping:
+        case NetworkCommand::Auth:
+        case NetworkCommand::Token:
+        case NetworkCommand::GameInfo:
+        case NetworkCommand::ObjectsList:
+        case NetworkCommand::Scripts:
+        case NetworkCommand::MapRequest:
+        case NetworkCommand::Heartbeat:
+            return false;
+        default:
+            return true;
+    }
+}
+
+bool NetworkPacketBuffer::CommandRequiresAuth() const
+{
+    return ::CommandRequiresAuth(Command);
+}
 
 NetworkPacket::NetworkPacket(NetworkCommand id)
     : Header{ 0, id }
@@ -42,22 +124,26 @@ void NetworkPacket::Clear()
     Data.clear();
 }
 
-bool NetworkPacket::CommandRequiresAuth()
+bool NetworkPacket::CommandRequiresAuth() const
 {
-    switch (GetCommand())
-    {
-        case NetworkCommand::Ping:
-        case NetworkCommand::Auth:
-        case NetworkCommand::Token:
-        case NetworkCommand::GameInfo:
-        case NetworkCommand::ObjectsList:
-        case NetworkCommand::Scripts:
-        case NetworkCommand::MapRequest:
-        case NetworkCommand::Heartbeat:
-            return false;
-        default:
-            return true;
-    }
+    return ::CommandRequiresAuth(GetCommand());
+}
+
+NetworkPacketBuffer NetworkPacket::Serialise() const
+{
+    PacketHeader header{ static_cast<uint16_t>(Data.size()), GetCommand() };
+
+    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
+    // Previously the Id field was not part of the header rather part of the body.
+    header.Size += sizeof(header.Id);
+    header.Size = Convert::HostToNetwork(header.Size);
+    header.Id = ByteSwapBE(header.Id);
+
+    auto bytes = NetworkPacketBufferPool::Get().Allocate(sizeof(header) + Data.size());
+    const auto* headerBytes = reinterpret_cast<const uint8_t*>(&header);
+    bytes->insert(bytes->end(), headerBytes, headerBytes + sizeof(header));
+    bytes->insert(bytes->end(), Data.begin(), Data.end());
+    return NetworkPacketBuffer{ GetCommand(), std::move(bytes) };
 }
 
 void NetworkPacket::Write(const void* bytes, size_t size)
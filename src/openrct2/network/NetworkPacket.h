@@ -25,6 +25,19 @@ struct PacketHeader
 static_assert(sizeof(PacketHeader) == 6);
 #pragma pack(pop)
 
+/**
+ * A packet serialised for sending, the header and payload as they go over the wire. The bytes are immutable so a packet
+ * queued on several connections is serialised once and shared, the memory is pooled and reused once it has been sent
+ * to every connection.
+ */
+struct NetworkPacketBuffer
+{
+    NetworkCommand Command = NetworkCommand::Invalid;
+    std::shared_ptr<const std::vector<uint8_t>> Bytes;
+
+    bool CommandRequiresAuth() const;
+};
+
 struct NetworkPacket final
 {
     NetworkPacket() = default;
@@ -36,7 +49,8 @@ struct NetworkPacket final
     NetworkCommand GetCommand() const;
 
     void Clear();
-    bool CommandRequiresAuth();
+    bool CommandRequiresAuth() const;
+    NetworkPacketBuffer Serialise() const;
 
     const uint8_t* Read(size_t size);
     std::string_view ReadString();
@@ -25,6 +25,11 @@ enum
     NETWORK_TICK_FLAG_CHECKSUMS = 1 << 0,
 };
 
+enum
+{
+    NETWORK_GAME_ACTION_BATCH_FLAG_GZIP = 1 << 0,
+};
+
 enum
 {
     NETWORK_MODE_NONE,
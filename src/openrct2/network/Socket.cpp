@@ -9,6 +9,7 @@
 
 #ifndef DISABLE_NETWORK
 
+#    include <algorithm>
 #    include <atomic>
 #    include <chrono>
 #    include <cmath>
@@ -49,8 +50,10 @@
     #include <netdb.h>
     #include <netinet/in.h>
     #include <netinet/tcp.h>
+    #include <poll.h>
     #include <sys/ioctl.h>
     #include <sys/socket.h>
+    #include <sys/uio.h>
     #include "../common.h"
     using SOCKET = int32_t;
     #define SOCKET_ERROR -1
@@ -59,6 +62,8 @@
     #define closesocket close
     #define ioctlsocket ioctl
     #if defined(__linux__)
+        #include <sys/epoll.h>
+        #include <unistd.h>
         #define FLAG_NO_PIPE MSG_NOSIGNAL
     #else
         #define FLAG_NO_PIPE 0
@@ -69,6 +74,7 @@
 #    include "Socket.h"
 
 constexpr auto CONNECT_TIMEOUT = std::chrono::milliseconds(3000);
+constexpr size_t MaxSendBuffers = 64;
 
 // RAII WSA initialisation needed for Windows
 #    ifdef _WIN32
@@ -259,6 +265,11 @@ private:
 public:
     TcpSocket() = default;
 
+    SOCKET GetSocket() const
+    {
+        return _socket;
+    }
+
     ~TcpSocket() override
     {
         if (_connectFuture.valid())
@@ -563,6 +574,60 @@ public:
         return totalSent;
     }
 
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
+    {
+        if (_status != SocketStatus::Connected)
+        {
+            throw std::runtime_error("Socket not connected.");
+        }
+
+        size_t totalSent = 0;
+        while (count > 0)
+        {
+            const size_t batchCount = std::min(count, MaxSendBuffers);
+            size_t batchSize = 0;
+#    ifdef _WIN32
+            WSABUF vecs[MaxSendBuffers];
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                vecs[i].buf = static_cast<CHAR*>(const_cast<void*>(buffers[i].Data));
+                vecs[i].len = static_cast<ULONG>(buffers[i].Size);
+                batchSize += buffers[i].Size;
+            }
+            DWORD sentBytes = 0;
+            if (WSASend(_socket, vecs, static_cast<DWORD>(batchCount), &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+#    else
+            iovec vecs[MaxSendBuffers];
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                vecs[i].iov_base = const_cast<void*>(buffers[i].Data);
+                vecs[i].iov_len = buffers[i].Size;
+                batchSize += buffers[i].Size;
+            }
+            msghdr message{};
+            message.msg_iov = vecs;
+            message.msg_iovlen = batchCount;
+            auto sentBytes = sendmsg(_socket, &message, FLAG_NO_PIPE);
+            if (sentBytes == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+#    endif
+            totalSent += static_cast<size_t>(sentBytes);
+            if (static_cast<size_t>(sentBytes) < batchSize)
+            {
+                // The send buffer of the socket is full.
+                break;
+            }
+            buffers += batchCount;
+            count -= batchCount;
+        }
+        return totalSent;
+    }
+
     NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
     {
         if (_status != SocketStatus::Connected)
@@ -887,6 +952,134 @@ std::unique_ptr<IUdpSocket> CreateUdpSocket()
     return std::make_unique<UdpSocket>();
 }
 
+#    ifdef __linux__
+class SocketPoller final : public ISocketPoller
+{
+private:
+    int _epoll = -1;
+    size_t _numSockets = 0;
+    std::vector<epoll_event> _events;
+
+public:
+    SocketPoller()
+    {
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        if (_epoll == -1)
+        {
+            throw SocketException("Unable to create epoll instance.");
+        }
+    }
+
+    ~SocketPoller() override
+    {
+        close(_epoll);
+    }
+
+    void Add(ITcpSocket& socket, void* tag) override
+    {
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLRDHUP;
+        ev.data.ptr = tag;
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, static_cast<TcpSocket&>(socket).GetSocket(), &ev) == -1)
+        {
+            throw SocketException("Unable to watch socket.");
+        }
+        _numSockets++;
+    }
+
+    void Remove(ITcpSocket& socket) override
+    {
+        // A closed socket has already been removed by the kernel, its descriptor may belong to another socket by now.
+        const auto fd = static_cast<TcpSocket&>(socket).GetSocket();
+        if (fd != INVALID_SOCKET)
+        {
+            epoll_ctl(_epoll, EPOLL_CTL_DEL, fd, nullptr);
+        }
+        _numSockets--;
+    }
+
+    void Poll(std::vector<void*>& readyTags, int32_t timeoutMs) override
+    {
+        _events.resize(std::max<size_t>(1, _numSockets));
+        const int numEvents = epoll_wait(_epoll, _events.data(), static_cast<int>(_events.size()), timeoutMs);
+        for (int i = 0; i < numEvents; i++)
+        {
+            readyTags.push_back(_events[i].data.ptr);
+        }
+    }
+};
+#    else
+class SocketPoller final : public ISocketPoller
+{
+private:
+    struct Entry
+    {
+        const TcpSocket* Socket;
+        void* Tag;
+    };
+
+    std::vector<Entry> _entries;
+    std::vector<pollfd> _fds;
+    std::vector<void*> _fdTags;
+
+public:
+    void Add(ITcpSocket& socket, void* tag) override
+    {
+        _entries.push_back({ &static_cast<TcpSocket&>(socket), tag });
+    }
+
+    void Remove(ITcpSocket& socket) override
+    {
+        auto it = std::find_if(
+            _entries.begin(), _entries.end(), [&socket](const Entry& e) { return e.Socket == &socket; });
+        if (it != _entries.end())
+        {
+            *it = _entries.back();
+            _entries.pop_back();
+        }
+    }
+
+    void Poll(std::vector<void*>& readyTags, int32_t timeoutMs) override
+    {
+        // The descriptors are taken each time, a socket that has been closed is skipped.
+        _fds.clear();
+        _fdTags.clear();
+        for (const auto& entry : _entries)
+        {
+            const auto fd = entry.Socket->GetSocket();
+            if (fd != INVALID_SOCKET)
+            {
+                _fds.push_back({ fd, POLLIN, 0 });
+                _fdTags.push_back(entry.Tag);
+            }
+        }
+        if (_fds.empty())
+        {
+            return;
+        }
+
+#        ifdef _WIN32
+        const int numReady = WSAPoll(_fds.data(), static_cast<ULONG>(_fds.size()), timeoutMs);
+#        else
+        const int numReady = poll(_fds.data(), static_cast<nfds_t>(_fds.size()), timeoutMs);
+#        endif
+        for (size_t i = 0; i < _fds.size() && numReady > 0; i++)
+        {
+            if (_fds[i].revents != 0)
+            {
+                readyTags.push_back(_fdTags[i]);
+            }
+        }
+    }
+};
+#    endif
+
+std::unique_ptr<ISocketPoller> CreateSocketPoller()
+{
+    InitialiseWSA();
+    return std::make_unique<SocketPoller>();
+}
+
 #    ifdef _WIN32
 static std::vector<INTERFACE_INFO> GetNetworkInterfaces()
 {
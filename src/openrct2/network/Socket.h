@@ -45,6 +45,12 @@ struct INetworkEndpoint
     virtual std::string GetHostname() const abstract;
 };
 
+struct SocketBuffer
+{
+    const void* Data;
+    size_t Size;
+};
+
 /**
  * Represents a TCP socket / connection or listener.
  */
@@ -66,6 +72,8 @@ public:
     virtual void ConnectAsync(const std::string& address, uint16_t port) abstract;
 
     virtual size_t SendData(const void* buffer, size_t size) abstract;
+    // Sends the buffers in order using scatter/gather I/O, returns the number of bytes sent.
+    virtual size_t SendData(const SocketBuffer* buffers, size_t count) abstract;
     virtual NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) abstract;
 
     virtual void SetNoDelay(bool noDelay) abstract;
@@ -98,8 +106,24 @@ public:
     virtual void Close() abstract;
 };
 
+/**
+ * Waits for many TCP sockets at once, so only the sockets with pending data or a pending connection have to be read.
+ * Uses epoll on Linux and poll elsewhere.
+ */
+struct ISocketPoller
+{
+    virtual ~ISocketPoller() = default;
+
+    virtual void Add(ITcpSocket& socket, void* tag) abstract;
+    virtual void Remove(ITcpSocket& socket) abstract;
+
+    // Appends the tags of the sockets that can be read without blocking, or that have been closed, to readyTags.
+    virtual void Poll(std::vector<void*>& readyTags, int32_t timeoutMs) abstract;
+};
+
 [[nodiscard]] std::unique_ptr<ITcpSocket> CreateTcpSocket();
 [[nodiscard]] std::unique_ptr<IUdpSocket> CreateUdpSocket();
+[[nodiscard]] std::unique_ptr<ISocketPoller> CreateSocketPoller();
 [[nodiscard]] std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses();
 
 namespace Convert
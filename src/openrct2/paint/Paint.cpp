@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -316,147 +317,138 @@ namespace PaintSortFlags
     static constexpr uint8_t OutsideQuadrant = (1U << 7);
 } // namespace PaintSortFlags
 
+/**
+ * Copy of a paint struct's sort state. The quadrant list is sorted on a flat array of these so the bounding boxes that are
+ * compared are next to each other in memory instead of being spread over the paint entry pool.
+ */
+struct PaintSortEntry
+{
+    paint_struct_bound_box Bounds;
+    paint_struct* Ps;
+    uint16_t QuadrantIndex;
+    uint8_t SortFlags;
+};
+
 template<uint8_t TRotation>
-static paint_struct* PaintArrangeStructsHelperRotation(paint_struct* ps_next, uint16_t quadrantIndex, uint8_t flag)
+static size_t PaintArrangeStructsHelperRotation(
+    std::vector<PaintSortEntry>& entries, size_t entryIndex, uint16_t quadrantIndex, uint8_t flag)
 {
-    paint_struct* ps;
-    paint_struct* ps_temp;
+    const size_t count = entries.size();
 
     // Get the first node in the specified quadrant.
-    do
-    {
-        ps = ps_next;
-        ps_next = ps_next->next_quadrant_ps;
-        if (ps_next == nullptr)
-            return ps;
-    } while (quadrantIndex > ps_next->quadrant_index);
-
-    // We keep track of the first node in the quadrant so the next call with a higher quadrant index
-    // can use this node to skip some iterations.
-    paint_struct* psQuadrantEntry = ps;
-
-    // Visit all nodes in the linked quadrant list and determine their current
-    // sorting relevancy.
-    ps_temp = ps;
-    do
+    while (true)
     {
-        ps = ps->next_quadrant_ps;
-        if (ps == nullptr)
+        if (entryIndex + 1 >= count)
+            return entryIndex;
+        if (quadrantIndex <= entries[entryIndex + 1].QuadrantIndex)
             break;
+        entryIndex++;
+    }
 
-        if (ps->quadrant_index > quadrantIndex + 1)
+    // Visit all nodes in the quadrant list and determine their current sorting relevancy.
+    for (size_t i = entryIndex + 1; i < count; i++)
+    {
+        auto& entry = entries[i];
+        if (entry.QuadrantIndex > quadrantIndex + 1)
         {
             // Outside of the range.
-            ps->SortFlags = PaintSortFlags::OutsideQuadrant;
+            entry.SortFlags = PaintSortFlags::OutsideQuadrant;
+            break;
         }
-        else if (ps->quadrant_index == quadrantIndex + 1)
+        if (entry.QuadrantIndex == quadrantIndex + 1)
         {
             // Is neighbour and requires a visit.
-            ps->SortFlags = PaintSortFlags::Neighbour | PaintSortFlags::PendingVisit;
+            entry.SortFlags = PaintSortFlags::Neighbour | PaintSortFlags::PendingVisit;
         }
-        else if (ps->quadrant_index == quadrantIndex)
+        else if (entry.QuadrantIndex == quadrantIndex)
         {
             // In specified quadrant, requires visit.
-            ps->SortFlags = flag | PaintSortFlags::PendingVisit;
+            entry.SortFlags = flag | PaintSortFlags::PendingVisit;
         }
-    } while (ps->quadrant_index <= quadrantIndex + 1);
-    ps = ps_temp;
+    }
 
     // Iterate all nodes in the current list and re-order them based on
     // the current rotation and their bounding box.
+    size_t current = entryIndex;
     while (true)
     {
         // Get the first pending node in the quadrant list
+        size_t visitIndex;
         while (true)
         {
-            ps_next = ps->next_quadrant_ps;
-            if (ps_next == nullptr)
+            visitIndex = current + 1;
+            if (visitIndex >= count || (entries[visitIndex].SortFlags & PaintSortFlags::OutsideQuadrant))
             {
-                // End of the current list.
-                return psQuadrantEntry;
+                // Reached the end of the list or a point outside of specified quadrant.
+                return entryIndex;
             }
-            if (ps_next->SortFlags & PaintSortFlags::OutsideQuadrant)
-            {
-                // Reached point outside of specified quadrant.
-                return psQuadrantEntry;
-            }
-            if (ps_next->SortFlags & PaintSortFlags::PendingVisit)
+            if (entries[visitIndex].SortFlags & PaintSortFlags::PendingVisit)
             {
                 // Found node to check on.
                 break;
             }
-            ps = ps_next;
+            current = visitIndex;
         }
 
         // Mark visited.
-        ps_next->SortFlags &= ~PaintSortFlags::PendingVisit;
-        ps_temp = ps;
+        entries[visitIndex].SortFlags &= ~PaintSortFlags::PendingVisit;
 
         // Compare current node against the remaining children.
-        const paint_struct_bound_box& initialBBox = ps_next->bounds;
-        while (true)
+        const paint_struct_bound_box initialBBox = entries[visitIndex].Bounds;
+        for (size_t i = visitIndex + 1; i < count; i++)
         {
-            ps = ps_next;
-            ps_next = ps_next->next_quadrant_ps;
-            if (ps_next == nullptr)
+            const auto& entry = entries[i];
+            if (entry.SortFlags & PaintSortFlags::OutsideQuadrant)
                 break;
-            if (ps_next->SortFlags & PaintSortFlags::OutsideQuadrant)
-                break;
-            if (!(ps_next->SortFlags & PaintSortFlags::Neighbour))
+            if (!(entry.SortFlags & PaintSortFlags::Neighbour))
                 continue;
 
-            const paint_struct_bound_box& currentBBox = ps_next->bounds;
-
-            const bool compareResult = CheckBoundingBox<TRotation>(initialBBox, currentBBox);
-
-            if (compareResult)
+            if (CheckBoundingBox<TRotation>(initialBBox, entry.Bounds))
             {
                 // Child node intersects with current node, move behind.
-                ps->next_quadrant_ps = ps_next->next_quadrant_ps;
-                paint_struct* ps_temp2 = ps_temp->next_quadrant_ps;
-                ps_temp->next_quadrant_ps = ps_next;
-                ps_next->next_quadrant_ps = ps_temp2;
-                ps_next = ps;
+                std::rotate(entries.begin() + current + 1, entries.begin() + i, entries.begin() + i + 1);
             }
         }
-
-        ps = ps_temp;
     }
 }
 
 template<int TRotation> static void PaintSessionArrange(PaintSessionCore& session, bool)
 {
     paint_struct* psHead = &session.PaintHead;
-
-    paint_struct* ps = psHead;
-    ps->next_quadrant_ps = nullptr;
+    psHead->next_quadrant_ps = nullptr;
 
     uint32_t quadrantIndex = session.QuadrantBackIndex;
-    if (quadrantIndex != UINT32_MAX)
+    if (quadrantIndex == UINT32_MAX)
+        return;
+
+    // Columns are arranged on the paint job threads, each thread has its own scratch buffer.
+    thread_local std::vector<PaintSortEntry> entries;
+    entries.clear();
+    entries.push_back({ psHead->bounds, psHead, psHead->quadrant_index, psHead->SortFlags });
+    do
     {
-        do
+        for (auto* ps = session.Quadrants[quadrantIndex]; ps != nullptr; ps = ps->next_quadrant_ps)
         {
-            paint_struct* ps_next = session.Quadrants[quadrantIndex];
-            if (ps_next != nullptr)
-            {
-                ps->next_quadrant_ps = ps_next;
-                do
-                {
-                    ps = ps_next;
-                    ps_next = ps_next->next_quadrant_ps;
+            entries.push_back({ ps->bounds, ps, ps->quadrant_index, ps->SortFlags });
+        }
+    } while (++quadrantIndex <= session.QuadrantFrontIndex);
 
-                } while (ps_next != nullptr);
-            }
-        } while (++quadrantIndex <= session.QuadrantFrontIndex);
+    size_t entryIndex = PaintArrangeStructsHelperRotation<TRotation>(
+        entries, 0, session.QuadrantBackIndex & 0xFFFF, PaintSortFlags::Neighbour);
 
-        paint_struct* ps_cache = PaintArrangeStructsHelperRotation<TRotation>(
-            psHead, session.QuadrantBackIndex & 0xFFFF, PaintSortFlags::Neighbour);
+    quadrantIndex = session.QuadrantBackIndex;
+    while (++quadrantIndex < session.QuadrantFrontIndex)
+    {
+        entryIndex = PaintArrangeStructsHelperRotation<TRotation>(
+            entries, entryIndex, quadrantIndex & 0xFFFF, PaintSortFlags::None);
+    }
 
-        quadrantIndex = session.QuadrantBackIndex;
-        while (++quadrantIndex < session.QuadrantFrontIndex)
-        {
-            ps_cache = PaintArrangeStructsHelperRotation<TRotation>(ps_cache, quadrantIndex & 0xFFFF, PaintSortFlags::None);
-        }
+    // Link the paint structs in their sorted order.
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        auto* ps = entries[i].Ps;
+        ps->SortFlags = entries[i].SortFlags;
+        ps->next_quadrant_ps = i + 1 < entries.size() ? entries[i + 1].Ps : nullptr;
     }
 }
 
@@ -1037,12 +1029,15 @@ paint_entry* PaintEntryPool::Chain::Allocate()
     }
     else if (Current->Count >= NodeSize)
     {
-        // We need another node
-        Current->Next = Pool->AllocateNode();
+        // We need another node, reuse the one kept from a previous frame if there is one
         if (Current->Next == nullptr)
         {
-            // Unable to allocate any more nodes
-            return nullptr;
+            Current->Next = Pool->AllocateNode();
+            if (Current->Next == nullptr)
+            {
+                // Unable to allocate any more nodes
+                return nullptr;
+            }
         }
         Current = Current->Next;
     }
@@ -1063,6 +1058,15 @@ void PaintEntryPool::Chain::Clear()
     assert(Current == nullptr);
 }
 
+void PaintEntryPool::Chain::Reset()
+{
+    for (auto node = Head; node != nullptr; node = node->Next)
+    {
+        node->Count = 0;
+    }
+    Current = Head;
+}
+
 size_t PaintEntryPool::Chain::GetCount() const
 {
     size_t count = 0;
@@ -167,6 +167,10 @@ public:
 
         paint_entry* Allocate();
         void Clear();
+        /**
+         * Rewinds the chain to its first node, the nodes are kept for the next frame instead of going back to the pool.
+         */
+        void Reset();
         size_t GetCount() const;
     };
 
@@ -151,7 +151,10 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
     session->ViewFlags = viewFlags;
     session->QuadrantBackIndex = std::numeric_limits<uint32_t>::max();
     session->QuadrantFrontIndex = 0;
-    session->PaintEntryChain = _paintStructPool.Create();
+    if (session->PaintEntryChain.Pool == nullptr)
+    {
+        session->PaintEntryChain = _paintStructPool.Create();
+    }
 
     std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
     session->LastPS = nullptr;
@@ -167,7 +170,8 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
 
 void Painter::ReleaseSession(paint_session* session)
 {
-    session->PaintEntryChain.Clear();
+    // The session keeps its paint entries for when it is reused, allocating then only rewinds the chain.
+    session->PaintEntryChain.Reset();
     _freePaintSessions.push_back(session);
 }
 
@@ -175,7 +179,7 @@ Painter::~Painter()
 {
     for (auto&& session : _paintSessionPool)
     {
-        ReleaseSession(session.get());
+        session->PaintEntryChain.Clear();
     }
     _paintSessionPool.clear();
 }
@@ -344,7 +344,8 @@ void PaintLargeScenery(paint_session& session, uint8_t direction, uint16_t heigh
 
     auto isGhost = false;
     ImageId imageTemplate;
-    if (gTrackDesignSaveMode && !track_design_save_contains_tile_element(reinterpret_cast<const TileElement*>(&tileElement)))
+    if (gTrackDesignSaveMode
+        && !track_design_save_contains_tile_element(session.MapPosition, reinterpret_cast<const TileElement*>(&tileElement)))
     {
         imageTemplate = ImageId().WithRemap(FilterPaletteID::Palette46);
         isGhost = true;
@@ -1001,7 +1001,7 @@ void PaintPath(paint_session& session, uint16_t height, const PathElement& tileE
             return;
         }
 
-        if (!track_design_save_contains_tile_element(reinterpret_cast<const TileElement*>(&tileElement)))
+        if (!track_design_save_contains_tile_element(session.MapPosition, reinterpret_cast<const TileElement*>(&tileElement)))
         {
             imageTemplate = ImageId().WithRemap(FilterPaletteID::Palette46);
         }
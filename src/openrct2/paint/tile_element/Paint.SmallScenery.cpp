@@ -123,7 +123,8 @@ void PaintSmallScenery(paint_session& session, uint8_t direction, int32_t height
     ImageId imageTemplate;
     if (gTrackDesignSaveMode)
     {
-        if (!track_design_save_contains_tile_element(reinterpret_cast<const TileElement*>(&sceneryElement)))
+        if (!track_design_save_contains_tile_element(
+                session.MapPosition, reinterpret_cast<const TileElement*>(&sceneryElement)))
         {
             imageTemplate = ImageId().WithRemap(FilterPaletteID::Palette46);
         }
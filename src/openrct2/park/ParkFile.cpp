@@ -56,6 +56,7 @@
 
 #include <cstdint>
 #include <ctime>
+#include <functional>
 #include <numeric>
 #include <optional>
 #include <string_view>
@@ -96,6 +97,8 @@ namespace OpenRCT2
         ObjectList RequiredObjects;
         std::vector<const ObjectRepositoryItem*> ExportObjectsList;
         bool OmitTracklessRides{};
+        // Writes the chunks without compressing them, for callers that compress or diff the data themselves.
+        bool Uncompressed{};
 
     private:
         std::unique_ptr<OrcaStream> _os;
@@ -146,11 +149,37 @@ namespace OpenRCT2
         void Save(IStream& stream)
         {
             OrcaStream os(stream, OrcaStream::Mode::WRITING);
+            WriteAllChunks(os);
+        }
+
+        /**
+         * Serialises the park, the returned function compresses the data and writes it to a stream without accessing
+         * the game state.
+         */
+        std::function<void(IStream& stream)> SaveDeferred()
+        {
+            OrcaStream os;
+            WriteAllChunks(os);
+            return os.TakeWriter();
+        }
 
+        void Save(const std::string_view& path)
+        {
+            FileStream fs(path, FILE_MODE_WRITE);
+            Save(fs);
+        }
+
+    private:
+        void WriteAllChunks(OrcaStream& os)
+        {
             auto& header = os.GetHeader();
             header.Magic = PARK_FILE_MAGIC;
             header.TargetVersion = PARK_FILE_CURRENT_VERSION;
             header.MinVersion = PARK_FILE_MIN_VERSION;
+            if (Uncompressed)
+            {
+                header.Compression = OrcaStream::COMPRESSION_NONE;
+            }
 
             ReadWriteAuthoringChunk(os);
             ReadWriteObjectsChunk(os);
@@ -170,12 +199,7 @@ namespace OpenRCT2
             ReadWritePackedObjectsChunk(os);
         }
 
-        void Save(const std::string_view& path)
-        {
-            FileStream fs(path, FILE_MODE_WRITE);
-            Save(fs);
-        }
-
+    public:
         scenario_index_entry ReadScenarioChunk()
         {
             scenario_index_entry entry{};
@@ -932,9 +956,14 @@ namespace OpenRCT2
                     }
                     else
                     {
-                        auto tileElements = GetReorganisedTileElementsWithoutGhosts();
-                        cs.Write(static_cast<uint32_t>(tileElements.size()));
-                        cs.Write(tileElements.data(), tileElements.size() * sizeof(TileElement));
+                        // Written straight from the map rather than from a copy without the ghosts.
+                        uint32_t numElements = 0;
+                        VisitTileElementsWithoutGhosts(
+                            [&numElements](const TileElement*, size_t count) { numElements += static_cast<uint32_t>(count); });
+                        cs.Write(numElements);
+                        VisitTileElementsWithoutGhosts([&cs](const TileElement* elements, size_t count) {
+                            cs.Write(elements, count * sizeof(TileElement));
+                        });
                     }
                 });
             if (!found)
@@ -2219,6 +2248,7 @@ void ParkFileExporter::Export(IStream& stream)
 {
     auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
     parkFile->ExportObjectsList = ExportObjectsList;
+    parkFile->Uncompressed = Uncompressed;
     parkFile->Save(stream);
 }
 
@@ -2281,6 +2311,39 @@ int32_t scenario_save(const utf8* path, int32_t flags)
     return result;
 }
 
+std::function<bool()> scenario_save_deferred(const utf8* path)
+{
+    log_verbose("saving game");
+    viewport_set_saved_view();
+
+    std::function<void(IStream&)> writer;
+    try
+    {
+        auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
+        parkFile->OmitTracklessRides = true;
+        writer = parkFile->SaveDeferred();
+    }
+    catch (const std::exception&)
+    {
+        return []() { return false; };
+    }
+
+    gfx_invalidate_screen();
+
+    return [writer = std::move(writer), path = std::string(path)]() {
+        try
+        {
+            FileStream fs(path, FILE_MODE_WRITE);
+            writer(fs);
+            return true;
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    };
+}
+
 class ParkFileImporter final : public IParkImporter
 {
 private:
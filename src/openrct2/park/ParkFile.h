@@ -8,10 +8,11 @@ struct ObjectRepositoryItem;
 namespace OpenRCT2
 {
     // Current version that is saved.
-    constexpr uint32_t PARK_FILE_CURRENT_VERSION = 0x8;
+    constexpr uint32_t PARK_FILE_CURRENT_VERSION = 0x9;
 
     // The minimum version that is forwards compatible with the current version.
-    constexpr uint32_t PARK_FILE_MIN_VERSION = 0x8;
+    // 0x9: chunks are compressed independently (OrcaStream::COMPRESSION_GZIP_CHUNKS).
+    constexpr uint32_t PARK_FILE_MIN_VERSION = 0x9;
 
     constexpr uint32_t PARK_FILE_MAGIC = 0x4B524150; // PARK
 
@@ -22,6 +23,7 @@ class ParkFileExporter
 {
 public:
     std::vector<const ObjectRepositoryItem*> ExportObjectsList;
+    bool Uncompressed{};
 
     void Export(std::string_view path);
     void Export(OpenRCT2::IStream& stream);
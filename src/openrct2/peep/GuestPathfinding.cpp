@@ -19,9 +19,15 @@
 #include "../util/Util.h"
 #include "../world/Entrance.h"
 #include "../world/Footpath.h"
+#include "../world/TileElementsView.h"
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <cstring>
+#include <limits>
+#include <optional>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -96,9 +102,9 @@ static TileElement* get_banner_on_path(TileElement* path_element)
     return nullptr;
 }
 
-static int32_t banner_clear_path_edges(PathElement* pathElement, int32_t edges)
+static int32_t banner_clear_path_edges(bool ignoreBanners, PathElement* pathElement, int32_t edges)
 {
-    if (_peepPathFindIsStaff)
+    if (ignoreBanners)
         return edges;
     TileElement* bannerElement = get_banner_on_path(reinterpret_cast<TileElement*>(pathElement));
     if (bannerElement != nullptr)
@@ -114,9 +120,15 @@ static int32_t banner_clear_path_edges(PathElement* pathElement, int32_t edges)
 /**
  * Gets the connected edges of a path that are permitted (i.e. no 'no entry' signs)
  */
+static int32_t path_get_permitted_edges(bool ignoreBanners, PathElement* pathElement)
+{
+    return banner_clear_path_edges(ignoreBanners, pathElement, pathElement->GetEdgesAndCorners()) & 0x0F;
+}
+
 static int32_t path_get_permitted_edges(PathElement* pathElement)
 {
-    return banner_clear_path_edges(pathElement, pathElement->GetEdgesAndCorners()) & 0x0F;
+    // Staff can walk through no entry banners.
+    return path_get_permitted_edges(_peepPathFindIsStaff, pathElement);
 }
 
 /**
@@ -558,6 +570,511 @@ static bool path_is_thin_junction(PathElement* path, const TileCoordsXYZ& loc)
     return thin_junction;
 }
 
+namespace OpenRCT2::FootpathGraph
+{
+    /**
+     * An element peep_pathfind_heuristic_search() can step onto, with everything the search needs to know about it that
+     * only depends on the map. Track nodes are shop candidates, the ride is checked when the node is visited.
+     */
+    struct Node
+    {
+        ride_id_t RideIndex;
+        uint8_t SearchResult;
+        uint8_t Height;
+        // Index among the path elements of the tile that are not ghosts, used to find the element again for staff on wide
+        // paths. Ghosts are skipped so that placing and removing them leaves the index as it was.
+        uint8_t PathIndex;
+        uint8_t NumEdges;
+        uint8_t PermittedEdges;
+        uint8_t StaffPermittedEdges;
+        Direction SlopeDirection;
+        bool IsWide;
+        bool IsQueue;
+        bool IsThinJunction;
+    };
+
+    /**
+     * The nodes reached when stepping onto a tile at a height in a direction, stored as a list per tile.
+     */
+    struct Step
+    {
+        uint32_t NextStep;
+        uint32_t FirstNode;
+        uint8_t NumNodes;
+        uint8_t Height;
+        Direction Edge;
+    };
+
+    struct TileEntry
+    {
+        uint32_t Generation;
+        uint32_t FirstStep;
+    };
+
+    static constexpr uint32_t NoStep = std::numeric_limits<uint32_t>::max();
+
+    // Tile invalidations leave the old nodes behind, the graph is dropped once it grew this large.
+    static constexpr size_t MaxNodes = 1 << 20;
+
+    // Generation 0 is never current so that fresh entries are always stale.
+    static uint32_t _generation = 1;
+    // One entry per tile of the map, _tilesMapSize is the map size they were allocated for.
+    static std::vector<TileEntry> _tiles;
+    static int32_t _tilesMapSize;
+    static std::vector<Step> _steps;
+    static std::vector<Node> _nodes;
+
+    /**
+     * Lower bounds on the number of steps from every tile to a goal tile, found by a breadth first search backwards over
+     * the edges of all path elements. Banners, wide paths, heights and the search limits only ever take moves away, so
+     * peep_pathfind_heuristic_search() cannot reach the goal in fewer steps than the distance of the tile it steps onto.
+     */
+    struct DistanceField
+    {
+        TileCoordsXY Goal;
+        uint32_t Generation;
+        uint32_t LastUsed;
+        int32_t MapSize;
+        std::vector<uint8_t> Distances;
+    };
+
+    // Searches end after 200 steps, tiles that are further away or unreachable all get this distance.
+    static constexpr uint8_t MaxDistance = 255;
+    static constexpr size_t MaxDistanceFields = 32;
+
+    /**
+     * Everything the direction chosen for a guest depends on besides the map and the ride types: where the guest is and
+     * where it is going, the edges left to try and the junctions it remembers. The junctions are kept in the order they
+     * are stored in, the search uses the first one that matches a location.
+     */
+    struct DirectionKey
+    {
+        TileCoordsXYZ Loc;
+        TileCoordsXYZ Goal;
+        std::array<TileCoordsXYZD, 4> History;
+        ride_id_t QueueRideIndex;
+        uint8_t Edges;
+        int8_t MaxJunctions;
+        bool IgnoreForeignQueues;
+    };
+
+    struct DirectionCacheEntry
+    {
+        DirectionKey Key;
+        uint32_t Generation;
+        Direction Result;
+    };
+
+    static constexpr size_t DirectionCacheSize = 4096;
+
+    // Bumped whenever the paths change, distance fields and cached directions of older generations are stale.
+    static uint32_t _pathGeneration = 1;
+    static uint32_t _distanceFieldUseCount;
+    static std::vector<DistanceField> _distanceFields;
+    static std::vector<DirectionCacheEntry> _directionCache;
+    static DirectionCacheStats _directionCacheStats;
+    static bool _directionCacheEnabled = true;
+
+    static bool IsTileValid(const TileCoordsXY& tileLoc, int32_t mapSize)
+    {
+        return tileLoc.x >= 0 && tileLoc.x < mapSize && tileLoc.y >= 0 && tileLoc.y < mapSize;
+    }
+
+    static void IncrementPathGeneration()
+    {
+        _pathGeneration++;
+        if (_pathGeneration == 0)
+        {
+            for (auto& field : _distanceFields)
+            {
+                field.Generation = 0;
+            }
+            for (auto& entry : _directionCache)
+            {
+                entry.Generation = 0;
+            }
+            _pathGeneration = 1;
+        }
+    }
+
+    void Invalidate()
+    {
+        IncrementPathGeneration();
+
+        _generation++;
+        if (_generation == 0)
+        {
+            // Wrapped around, old entries could look current again.
+            _tiles.clear();
+            _tilesMapSize = 0;
+            _generation = 1;
+        }
+        _steps.clear();
+        _nodes.clear();
+    }
+
+    void InvalidateTile(const CoordsXY& loc)
+    {
+        IncrementPathGeneration();
+
+        if (_tiles.empty())
+            return;
+
+        // The edges of the neighbouring paths may have changed as well, and the thin junction flags of a tile depend on
+        // the paths of its neighbours, so everything up to two tiles away is dropped.
+        const TileCoordsXY tileLoc(loc);
+        for (int32_t y = tileLoc.y - 2; y <= tileLoc.y + 2; y++)
+        {
+            for (int32_t x = tileLoc.x - 2; x <= tileLoc.x + 2; x++)
+            {
+                if (IsTileValid({ x, y }, _tilesMapSize))
+                {
+                    _tiles[y * _tilesMapSize + x].Generation = 0;
+                }
+            }
+        }
+    }
+
+    bool UsesElementType(TileElementType type)
+    {
+        switch (type)
+        {
+            case TileElementType::Path:
+            case TileElementType::Track:
+            case TileElementType::Entrance:
+            case TileElementType::Banner:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static void Trim()
+    {
+        if (_nodes.size() > MaxNodes)
+        {
+            Invalidate();
+        }
+    }
+
+    /**
+     * Adds the nodes for stepping onto loc in the given direction, this follows the element loop of the original
+     * search exactly, including the height of loc being moved to the base of each path that is passed.
+     */
+    static void AddNodes(TileCoordsXYZ loc, Direction edge)
+    {
+        TileElement* tileElement = map_get_first_element_at(loc);
+        if (tileElement == nullptr)
+            return;
+
+        int32_t pathIndex = -1;
+        do
+        {
+            if (tileElement->IsGhost())
+                continue;
+            if (tileElement->GetType() == TileElementType::Path)
+                pathIndex++;
+
+            Node node{};
+            node.RideIndex = RIDE_ID_NULL;
+            node.SlopeDirection = INVALID_DIRECTION;
+            switch (tileElement->GetType())
+            {
+                case TileElementType::Track:
+                    if (loc.z != tileElement->base_height)
+                        continue;
+                    node.SearchResult = PATH_SEARCH_SHOP_ENTRANCE;
+                    node.RideIndex = tileElement->AsTrack()->GetRideIndex();
+                    break;
+                case TileElementType::Entrance:
+                    if (loc.z != tileElement->base_height)
+                        continue;
+                    switch (tileElement->AsEntrance()->GetEntranceType())
+                    {
+                        case ENTRANCE_TYPE_RIDE_ENTRANCE:
+                            if (tileElement->GetDirection() != edge)
+                                continue;
+                            node.SearchResult = PATH_SEARCH_RIDE_ENTRANCE;
+                            node.RideIndex = tileElement->AsEntrance()->GetRideIndex();
+                            break;
+                        case ENTRANCE_TYPE_PARK_ENTRANCE:
+                            node.SearchResult = PATH_SEARCH_PARK_EXIT;
+                            break;
+                        case ENTRANCE_TYPE_RIDE_EXIT:
+                            if (tileElement->GetDirection() != edge)
+                                continue;
+                            node.SearchResult = PATH_SEARCH_RIDE_EXIT;
+                            break;
+                        default:
+                            continue;
+                    }
+                    break;
+                case TileElementType::Path:
+                {
+                    if (!IsValidPathZAndDirection(tileElement, loc.z, edge))
+                        continue;
+
+                    loc.z = tileElement->base_height;
+                    auto* pathElement = tileElement->AsPath();
+                    node.SearchResult = PATH_SEARCH_THIN;
+                    node.RideIndex = pathElement->GetRideIndex();
+                    node.PathIndex = static_cast<uint8_t>(pathIndex);
+                    node.NumEdges = bitcount(pathElement->GetEdges());
+                    node.PermittedEdges = path_get_permitted_edges(false, pathElement);
+                    node.StaffPermittedEdges = path_get_permitted_edges(true, pathElement);
+                    if (pathElement->IsSloped())
+                        node.SlopeDirection = pathElement->GetSlopeDirection();
+                    node.IsWide = pathElement->IsWide();
+                    node.IsQueue = pathElement->IsQueue();
+                    node.IsThinJunction = node.NumEdges > 2 && path_is_thin_junction(pathElement, loc);
+                    break;
+                }
+                default:
+                    continue;
+            }
+            node.Height = loc.z;
+            _nodes.push_back(node);
+        } while (!(tileElement++)->IsLastForTile());
+    }
+
+    /**
+     * Returns the step for walking onto loc in the given direction, building it on first use. The returned indices
+     * stay valid for the whole search, nodes are only dropped between searches.
+     */
+    static Step GetStep(const TileCoordsXYZ& loc, Direction edge)
+    {
+        // Paths can only be placed inside the map, the tiles outside of it have no nodes.
+        if (!IsTileValid(loc, gMapSize))
+            return Step{ NoStep, 0, 0, 0, edge };
+
+        if (_tilesMapSize != gMapSize)
+        {
+            _tilesMapSize = gMapSize;
+            _tiles.assign(static_cast<size_t>(_tilesMapSize) * _tilesMapSize, TileEntry{ 0, NoStep });
+        }
+
+        const size_t tileIndex = loc.y * _tilesMapSize + loc.x;
+        if (_tiles[tileIndex].Generation != _generation)
+        {
+            _tiles[tileIndex] = { _generation, NoStep };
+        }
+
+        for (auto stepIndex = _tiles[tileIndex].FirstStep; stepIndex != NoStep; stepIndex = _steps[stepIndex].NextStep)
+        {
+            const auto& step = _steps[stepIndex];
+            if (step.Height == loc.z && step.Edge == edge)
+                return step;
+        }
+
+        Step step{};
+        step.NextStep = _tiles[tileIndex].FirstStep;
+        step.FirstNode = static_cast<uint32_t>(_nodes.size());
+        step.Height = static_cast<uint8_t>(loc.z);
+        step.Edge = edge;
+        AddNodes(loc, edge);
+        step.NumNodes = static_cast<uint8_t>(_nodes.size() - step.FirstNode);
+
+        _tiles[tileIndex].FirstStep = static_cast<uint32_t>(_steps.size());
+        _steps.push_back(step);
+        return step;
+    }
+
+    static TileElement* GetPathElement(const TileCoordsXY& loc, const Node& node)
+    {
+        int32_t pathIndex = 0;
+        for (auto* pathElement : TileElementsView<PathElement>(loc.ToCoordsXY()))
+        {
+            if (pathElement->IsGhost())
+                continue;
+            if (pathIndex++ == node.PathIndex)
+                return reinterpret_cast<TileElement*>(pathElement);
+        }
+        return nullptr;
+    }
+
+    static bool IsTileInField(const DistanceField& field, const TileCoordsXY& tileLoc)
+    {
+        return tileLoc.x >= 0 && tileLoc.x < field.MapSize && tileLoc.y >= 0 && tileLoc.y < field.MapSize;
+    }
+
+    static uint8_t GetPathEdges(const TileCoordsXY& tileLoc)
+    {
+        uint8_t edges = 0;
+        for (auto* pathElement : TileElementsView<PathElement>(tileLoc.ToCoordsXY()))
+        {
+            edges |= pathElement->GetEdges();
+        }
+        return edges;
+    }
+
+    static void BuildDistanceField(DistanceField& field)
+    {
+        field.Generation = _pathGeneration;
+        field.MapSize = gMapSize;
+        field.Distances.assign(field.MapSize * field.MapSize, MaxDistance);
+        if (!IsTileInField(field, field.Goal))
+            return;
+
+        std::vector<TileCoordsXY> queue;
+        queue.push_back(field.Goal);
+        field.Distances[field.Goal.y * field.MapSize + field.Goal.x] = 0;
+        for (size_t i = 0; i < queue.size(); i++)
+        {
+            const auto tileLoc = queue[i];
+            const uint8_t distance = field.Distances[tileLoc.y * field.MapSize + tileLoc.x] + 1;
+            if (distance == MaxDistance)
+                continue;
+
+            for (Direction direction : ALL_DIRECTIONS)
+            {
+                // The neighbour is a step further away if one of its paths leads onto this tile.
+                const auto neighbour = tileLoc + TileDirectionDelta[direction_reverse(direction)];
+                if (!IsTileInField(field, neighbour))
+                    continue;
+
+                auto& neighbourDistance = field.Distances[neighbour.y * field.MapSize + neighbour.x];
+                if (neighbourDistance != MaxDistance || !(GetPathEdges(neighbour) & (1 << direction)))
+                    continue;
+
+                neighbourDistance = distance;
+                queue.push_back(neighbour);
+            }
+        }
+    }
+
+    /**
+     * Returns the distance field of the goal, shared by all peeps heading there. Fields are built on first use after the
+     * footpaths changed, the least recently used field is replaced once there are too many goals.
+     */
+    static const DistanceField& GetDistanceField(const TileCoordsXY& goal)
+    {
+        _distanceFieldUseCount++;
+
+        auto it = std::find_if(
+            _distanceFields.begin(), _distanceFields.end(), [&goal](const DistanceField& field) { return field.Goal == goal; });
+        if (it == _distanceFields.end())
+        {
+            if (_distanceFields.size() < MaxDistanceFields)
+            {
+                it = _distanceFields.insert(_distanceFields.end(), DistanceField{});
+            }
+            else
+            {
+                it = std::min_element(_distanceFields.begin(), _distanceFields.end(), [](const auto& a, const auto& b) {
+                    return a.LastUsed < b.LastUsed;
+                });
+            }
+            it->Goal = goal;
+            it->Generation = 0;
+        }
+
+        if (it->Generation != _pathGeneration || it->MapSize != gMapSize)
+        {
+            BuildDistanceField(*it);
+        }
+        it->LastUsed = _distanceFieldUseCount;
+        return *it;
+    }
+
+    static uint8_t GetDistance(const DistanceField& field, const TileCoordsXY& tileLoc)
+    {
+        if (!IsTileInField(field, tileLoc))
+            return MaxDistance;
+        return field.Distances[tileLoc.y * field.MapSize + tileLoc.x];
+    }
+
+    static DirectionKey GetDirectionKey(const TileCoordsXYZ& loc, const Peep& peep, uint8_t edges)
+    {
+        DirectionKey key{};
+        key.Loc = loc;
+        key.Goal = gPeepPathFindGoalPosition;
+        key.History = peep.PathfindHistory;
+        key.QueueRideIndex = gPeepPathFindQueueRideIndex;
+        key.Edges = edges;
+        key.MaxJunctions = _peepPathFindMaxJunctions;
+        key.IgnoreForeignQueues = gPeepPathFindIgnoreForeignQueues;
+        return key;
+    }
+
+    static bool operator==(const DirectionKey& a, const DirectionKey& b)
+    {
+        for (size_t i = 0; i < a.History.size(); i++)
+        {
+            if (a.History[i] != b.History[i] || a.History[i].direction != b.History[i].direction)
+                return false;
+        }
+        return a.Loc == b.Loc && a.Goal == b.Goal && a.QueueRideIndex == b.QueueRideIndex && a.Edges == b.Edges
+            && a.MaxJunctions == b.MaxJunctions && a.IgnoreForeignQueues == b.IgnoreForeignQueues;
+    }
+
+    static size_t GetDirectionCacheIndex(const DirectionKey& key)
+    {
+        uint32_t hash = 0;
+        auto add = [&hash](int32_t value) { hash = (hash ^ static_cast<uint32_t>(value)) * 0x01000193; };
+        add(key.Loc.x);
+        add(key.Loc.y);
+        add(key.Loc.z);
+        add(key.Goal.x);
+        add(key.Goal.y);
+        add(key.Goal.z);
+        for (const auto& junction : key.History)
+        {
+            add(junction.x);
+            add(junction.y);
+            add(junction.z);
+            add(junction.direction);
+        }
+        add(static_cast<int32_t>(key.QueueRideIndex));
+        add(key.Edges);
+        add(key.MaxJunctions);
+        add(key.IgnoreForeignQueues);
+        return hash % DirectionCacheSize;
+    }
+
+    /**
+     * Returns the direction chosen earlier for another guest with the same key, the direction cache is direct mapped and
+     * only holds the last direction stored in each slot.
+     */
+    static std::optional<Direction> GetCachedDirection(const DirectionKey& key)
+    {
+        if (!_directionCacheEnabled)
+            return std::nullopt;
+
+        if (_directionCache.empty())
+        {
+            _directionCache.resize(DirectionCacheSize);
+        }
+
+        const auto& entry = _directionCache[GetDirectionCacheIndex(key)];
+        if (entry.Generation == _pathGeneration && entry.Key == key)
+        {
+            _directionCacheStats.Hits++;
+            return entry.Result;
+        }
+        _directionCacheStats.Misses++;
+        return std::nullopt;
+    }
+
+    static void CacheDirection(const DirectionKey& key, Direction result)
+    {
+        if (_directionCacheEnabled && !_directionCache.empty())
+        {
+            _directionCache[GetDirectionCacheIndex(key)] = { key, _pathGeneration, result };
+        }
+    }
+
+    DirectionCacheStats GetDirectionCacheStats()
+    {
+        return _directionCacheStats;
+    }
+
+    void SetDirectionCacheEnabled(bool enabled)
+    {
+        _directionCacheEnabled = enabled;
+        _directionCache.clear();
+    }
+} // namespace OpenRCT2::FootpathGraph
+
 static int32_t CalculateHeuristicPathingScore(const TileCoordsXYZ& loc1, const TileCoordsXYZ& loc2)
 {
     auto xDelta = abs(loc1.x - loc2.x) * 32;
@@ -685,20 +1202,12 @@ static constexpr const char* pathSearchToString(uint8_t pathFindSearchResult)
  *  rct2: 0x0069A997
  */
 static void peep_pathfind_heuristic_search(
-    TileCoordsXYZ loc, Peep* peep, TileElement* currentTileElement, bool inPatrolArea, uint8_t counter, uint16_t* endScore,
+    TileCoordsXYZ loc, Peep* peep, bool currentElementIsWide, bool inPatrolArea, uint8_t counter, uint16_t* endScore,
     Direction test_edge, uint8_t* endJunctions, TileCoordsXYZ junctionList[16], uint8_t directionList[16],
     TileCoordsXYZ* endXYZ, uint8_t* endSteps)
 {
     uint8_t searchResult = PATH_SEARCH_FAILED;
 
-    bool currentElementIsWide = currentTileElement->AsPath()->IsWide();
-    if (currentElementIsWide)
-    {
-        const Staff* staff = peep->As<Staff>();
-        if (staff != nullptr && staff->CanIgnoreWideFlag(loc.ToCoordsXYZ(), currentTileElement))
-            currentElementIsWide = false;
-    }
-
     loc += TileDirectionDelta[test_edge];
 
     ++counter;
@@ -738,100 +1247,51 @@ static void peep_pathfind_heuristic_search(
         }
     }
 
-    /* Get the next map element of interest in the direction of test_edge. */
+    /* Get the next map elements of interest in the direction of test_edge,
+     * the elements the peep could walk onto while navigating to the goal
+     * (including the goal tile) are taken from the cached footpath graph. */
     bool found = false;
-    TileElement* tileElement = map_get_first_element_at(loc);
-    if (tileElement == nullptr)
-    {
-        return;
-    }
-    do
+    const auto step = FootpathGraph::GetStep(loc, test_edge);
+    for (uint32_t nodeIndex = step.FirstNode; nodeIndex < step.FirstNode + step.NumNodes; nodeIndex++)
     {
-        /* Look for all map elements that the peep could walk onto while
-         * navigating to the goal, including the goal tile. */
+        /* Copied, the recursive calls below can grow the graph. */
+        const auto node = FootpathGraph::_nodes[nodeIndex];
+        loc.z = node.Height;
 
-        if (tileElement->IsGhost())
-            continue;
-
-        ride_id_t rideIndex = RIDE_ID_NULL;
-        switch (tileElement->GetType())
+        searchResult = node.SearchResult;
+        switch (searchResult)
         {
-            case TileElementType::Track:
+            case PATH_SEARCH_SHOP_ENTRANCE:
             {
-                if (loc.z != tileElement->base_height)
-                    continue;
                 /* For peeps heading for a shop, the goal is the shop
                  * tile. */
-                rideIndex = tileElement->AsTrack()->GetRideIndex();
-                auto ride = get_ride(rideIndex);
+                auto ride = get_ride(node.RideIndex);
                 if (ride == nullptr || !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_IS_SHOP))
                     continue;
 
                 found = true;
-                searchResult = PATH_SEARCH_SHOP_ENTRANCE;
                 break;
             }
-            case TileElementType::Entrance:
-                if (loc.z != tileElement->base_height)
-                    continue;
-                Direction direction;
-                searchResult = PATH_SEARCH_OTHER;
-                switch (tileElement->AsEntrance()->GetEntranceType())
-                {
-                    case ENTRANCE_TYPE_RIDE_ENTRANCE:
-                        /* For peeps heading for a ride without a queue, the
-                         * goal is the ride entrance tile.
-                         * For mechanics heading for the ride entrance
-                         * (in the case when the station has no exit),
-                         * the goal is the ride entrance tile. */
-                        direction = tileElement->GetDirection();
-                        if (direction == test_edge)
-                        {
-                            /* The rideIndex will be useful for
-                             * adding transport rides later. */
-                            rideIndex = tileElement->AsEntrance()->GetRideIndex();
-                            searchResult = PATH_SEARCH_RIDE_ENTRANCE;
-                            found = true;
-                            break;
-                        }
-                        continue; // Ride entrance is not facing the right direction.
-                    case ENTRANCE_TYPE_PARK_ENTRANCE:
-                        /* For peeps leaving the park, the goal is the park
-                         * entrance/exit tile. */
-                        searchResult = PATH_SEARCH_PARK_EXIT;
-                        found = true;
-                        break;
-                    case ENTRANCE_TYPE_RIDE_EXIT:
-                        /* For mechanics heading for the ride exit, the
-                         * goal is the ride exit tile. */
-                        direction = tileElement->GetDirection();
-                        if (direction == test_edge)
-                        {
-                            searchResult = PATH_SEARCH_RIDE_EXIT;
-                            found = true;
-                            break;
-                        }
-                        continue; // Ride exit is not facing the right direction.
-                    default:
-                        continue;
-                }
+            case PATH_SEARCH_RIDE_ENTRANCE:
+            case PATH_SEARCH_RIDE_EXIT:
+            case PATH_SEARCH_PARK_EXIT:
+                /* For peeps heading for a ride without a queue, the goal
+                 * is the ride entrance tile facing test_edge; for peeps
+                 * leaving the park the park entrance/exit tile; for
+                 * mechanics the ride entrance or exit tile. */
+                found = true;
                 break;
-            case TileElementType::Path:
+            default:
             {
                 /* For peeps heading for a ride with a queue, the goal is the last
                  * queue path.
                  * Otherwise, peeps walk on path tiles to get to the goal. */
 
-                if (!IsValidPathZAndDirection(tileElement, loc.z, test_edge))
-                    continue;
-
-                // Path may be sloped, so set z to path base height.
-                loc.z = tileElement->base_height;
-
-                if (tileElement->AsPath()->IsWide())
+                if (node.IsWide)
                 {
                     /* Check if staff can ignore this wide flag. */
-                    if (staff == nullptr || !staff->CanIgnoreWideFlag(loc.ToCoordsXYZ(), tileElement))
+                    if (staff == nullptr
+                        || !staff->CanIgnoreWideFlag(loc.ToCoordsXYZ(), FootpathGraph::GetPathElement(loc, node)))
                     {
                         searchResult = PATH_SEARCH_WIDE;
                         found = true;
@@ -841,27 +1301,21 @@ static void peep_pathfind_heuristic_search(
 
                 searchResult = PATH_SEARCH_THIN;
 
-                uint8_t numEdges = bitcount(tileElement->AsPath()->GetEdges());
-
-                if (numEdges < 2)
+                if (node.NumEdges < 2)
                 {
                     searchResult = PATH_SEARCH_DEAD_END;
                 }
-                else if (numEdges > 2)
+                else if (node.NumEdges > 2)
                 {
                     searchResult = PATH_SEARCH_JUNCTION;
                 }
                 else
                 { // numEdges == 2
-                    if (tileElement->AsPath()->IsQueue()
-                        && tileElement->AsPath()->GetRideIndex() != gPeepPathFindQueueRideIndex)
+                    if (node.IsQueue && node.RideIndex != gPeepPathFindQueueRideIndex)
                     {
-                        if (gPeepPathFindIgnoreForeignQueues && (tileElement->AsPath()->GetRideIndex() != RIDE_ID_NULL))
+                        if (gPeepPathFindIgnoreForeignQueues && (node.RideIndex != RIDE_ID_NULL))
                         {
                             // Path is a queue we aren't interested in
-                            /* The rideIndex will be useful for
-                             * adding transport rides later. */
-                            rideIndex = tileElement->AsPath()->GetRideIndex();
                             searchResult = PATH_SEARCH_RIDE_QUEUE;
                         }
                     }
@@ -869,8 +1323,6 @@ static void peep_pathfind_heuristic_search(
                 found = true;
             }
             break;
-            default:
-                continue;
         }
 
 #
@@ -990,8 +1442,7 @@ static void peep_pathfind_heuristic_search(
         /* At this point the map element is a non-wide path.*/
 
         /* Get all the permitted_edges of the map element. */
-        Guard::Assert(tileElement->AsPath() != nullptr);
-        uint8_t edges = path_get_permitted_edges(tileElement->AsPath());
+        uint8_t edges = _peepPathFindIsStaff ? node.StaffPermittedEdges : node.PermittedEdges;
 
 #if defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
         if (gPathFindDebug)
@@ -1062,7 +1513,7 @@ static void peep_pathfind_heuristic_search(
         {
             /* Check if this is a thin junction. And perform additional
              * necessary checks. */
-            thin_junction = path_is_thin_junction(tileElement->AsPath(), loc);
+            thin_junction = node.IsThinJunction;
 
             if (thin_junction)
             {
@@ -1180,10 +1631,20 @@ static void peep_pathfind_heuristic_search(
             uint8_t savedNumJunctions = _peepPathFindNumJunctions;
 
             uint8_t height = loc.z;
-            if (tileElement->AsPath()->IsSloped() && tileElement->AsPath()->GetSlopeDirection() == next_test_edge)
+            if (node.SlopeDirection == next_test_edge)
             {
                 height += 2;
             }
+
+            /* Only staff walk onto wide paths, if they can ignore the wide
+             * flag from where they step off again. */
+            bool nextElementIsWide = node.IsWide;
+            if (nextElementIsWide && staff != nullptr
+                && staff->CanIgnoreWideFlag(
+                    TileCoordsXYZ{ loc.x, loc.y, height }.ToCoordsXYZ(), FootpathGraph::GetPathElement(loc, node)))
+            {
+                nextElementIsWide = false;
+            }
 #if defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
             if (gPathFindDebug)
             {
@@ -1214,8 +1675,8 @@ static void peep_pathfind_heuristic_search(
             }
 
             peep_pathfind_heuristic_search(
-                { loc.x, loc.y, height }, peep, tileElement, nextInPatrolArea, counter, endScore, next_test_edge, endJunctions,
-                junctionList, directionList, endXYZ, endSteps);
+                { loc.x, loc.y, height }, peep, nextElementIsWide, nextInPatrolArea, counter, endScore, next_test_edge,
+                endJunctions, junctionList, directionList, endXYZ, endSteps);
             _peepPathFindNumJunctions = savedNumJunctions;
 
 #if defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
@@ -1228,7 +1689,7 @@ static void peep_pathfind_heuristic_search(
 #endif // defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
         } while ((next_test_edge = bitscanforward(edges)) != -1);
 
-    } while (!(tileElement++)->IsLastForTile());
+    }
 
     if (!found)
     {
@@ -1270,6 +1731,8 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
     // Used to allow walking through no entry banners
     _peepPathFindIsStaff = peep->Is<Staff>();
 
+    FootpathGraph::Trim();
+
     TileCoordsXYZ goal = gPeepPathFindGoalPosition;
 
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
@@ -1424,8 +1887,30 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
 
     int32_t chosen_edge = bitscanforward(edges);
 
+    /* Guests at the same junction heading for the same goal with the same
+     * edges left to try get the same direction, so the result of the search
+     * is shared between them until the paths or ride types change. The
+     * searches of staff depend on their patrol areas and are not cached. */
+    bool useDirectionCache = !_peepPathFindIsStaff && (edges & ~(1 << chosen_edge));
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+    useDirectionCache &= !_pathFindDebug;
+#endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+    std::optional<Direction> cachedDirection;
+    FootpathGraph::DirectionKey directionKey{};
+    if (useDirectionCache)
+    {
+        directionKey = FootpathGraph::GetDirectionKey(loc, *peep, edges);
+        cachedDirection = FootpathGraph::GetCachedDirection(directionKey);
+    }
+
+    if (cachedDirection.has_value())
+    {
+        if (*cachedDirection == INVALID_DIRECTION)
+            return INVALID_DIRECTION;
+        chosen_edge = *cachedDirection;
+    }
     // Peep has multiple edges still to try.
-    if (edges & ~(1 << chosen_edge))
+    else if (edges & ~(1 << chosen_edge))
     {
         uint16_t best_score = 0xFFFF;
         uint8_t best_sub = 0xFF;
@@ -1445,11 +1930,39 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
         /* Call the search heuristic on each edge, keeping track of the
          * edge that gives the best (i.e. smallest) value (best_score)
          * or for different edges with equal value, the edge with the
-         * least steps (best_sub). */
+         * least steps (best_sub), then the lowest edge. */
         int32_t numEdges = bitcount(edges);
-        for (int32_t test_edge = chosen_edge; test_edge != -1; test_edge = bitscanforward(edges))
+
+        /* The edges are searched closest to the goal first. Once an edge
+         * reached the goal, the edges whose distance to the goal means
+         * they cannot reach it in fewer steps are not searched at all.
+         * This gives the same edge as searching all of them. */
+        const auto& distanceField = FootpathGraph::GetDistanceField({ goal.x, goal.y });
+        uint16_t minSteps[NumOrthogonalDirections]{};
+        Direction searchOrder[NumOrthogonalDirections]{};
+        int32_t numSearchEdges = 0;
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            if (edges & (1 << direction))
+            {
+                const auto nextTile = TileCoordsXY{ loc.x, loc.y } + TileDirectionDelta[direction];
+                minSteps[direction] = 1 + FootpathGraph::GetDistance(distanceField, nextTile);
+                searchOrder[numSearchEdges++] = direction;
+            }
+        }
+        std::stable_sort(searchOrder, searchOrder + numSearchEdges, [&minSteps](Direction a, Direction b) {
+            return minSteps[a] < minSteps[b];
+        });
+
+        for (int32_t i = 0; i < numSearchEdges; i++)
         {
-            edges &= ~(1 << test_edge);
+            const Direction test_edge = searchOrder[i];
+            if (best_score == 0
+                && (minSteps[test_edge] > best_sub || (minSteps[test_edge] == best_sub && test_edge > chosen_edge)))
+            {
+                continue;
+            }
+
             uint8_t height = loc.z;
 
             if (first_tile_element->AsPath()->IsSloped() && first_tile_element->AsPath()->GetSlopeDirection() == test_edge)
@@ -1516,8 +2029,15 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
             }
 #endif // defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
 
+            bool currentElementIsWide = first_tile_element->AsPath()->IsWide();
+            if (currentElementIsWide && staff != nullptr
+                && staff->CanIgnoreWideFlag(TileCoordsXYZ{ loc.x, loc.y, height }.ToCoordsXYZ(), first_tile_element))
+            {
+                currentElementIsWide = false;
+            }
+
             peep_pathfind_heuristic_search(
-                { loc.x, loc.y, height }, peep, first_tile_element, inPatrolArea, 0, &score, test_edge, &endJunctions,
+                { loc.x, loc.y, height }, peep, currentElementIsWide, inPatrolArea, 0, &score, test_edge, &endJunctions,
                 endJunctionList, endDirectionList, &endXYZ, &endSteps);
 
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
@@ -1535,7 +2055,8 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
             }
 #endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
 
-            if (score < best_score || (score == best_score && endSteps < best_sub))
+            if (score < best_score
+                || (score == best_score && (endSteps < best_sub || (endSteps == best_sub && test_edge < chosen_edge))))
             {
                 chosen_edge = test_edge;
                 best_score = score;
@@ -1567,8 +2088,16 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
                 log_verbose("Pathfind heuristic search failed.");
             }
 #endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+            if (useDirectionCache)
+            {
+                FootpathGraph::CacheDirection(directionKey, INVALID_DIRECTION);
+            }
             return INVALID_DIRECTION;
         }
+        if (useDirectionCache)
+        {
+            FootpathGraph::CacheDirection(directionKey, chosen_edge);
+        }
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
         if (_pathFindDebug)
         {
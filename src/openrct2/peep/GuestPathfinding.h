@@ -16,6 +16,7 @@
 struct Peep;
 struct Guest;
 struct TileElement;
+enum class TileElementType : uint8_t;
 
 // The tile position of the place the peep is trying to get to (park entrance/exit, ride
 // entrance/exit, or the end of the queue line for a ride).
@@ -45,6 +46,44 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep);
 // moving in direction currentDirection.
 bool IsValidPathZAndDirection(TileElement* tileElement, int32_t currentZ, int32_t currentDirection);
 
+namespace OpenRCT2::FootpathGraph
+{
+    /**
+     * Drops the cached footpath graph the heuristic search walks, call whenever paths, banners, entrances, track or ride
+     * types may have changed anywhere on the map.
+     */
+    void Invalidate();
+
+    /**
+     * Drops the cached footpath graph around a tile, call when elements on the tile or the edges of the paths next to it
+     * were added, removed or changed.
+     */
+    void InvalidateTile(const CoordsXY& loc);
+
+    /**
+     * Returns whether elements of the type are part of the footpath graph, changes to other elements need no invalidation.
+     */
+    bool UsesElementType(TileElementType type);
+
+    struct DirectionCacheStats
+    {
+        uint64_t Hits;
+        uint64_t Misses;
+    };
+
+    /**
+     * Returns how often a guest got the direction chosen earlier for another guest at the same junction with the same goal,
+     * instead of running the heuristic search itself.
+     */
+    DirectionCacheStats GetDirectionCacheStats();
+
+    /**
+     * Turns the cached directions on or off, every guest runs the heuristic search itself while they are off. A cached
+     * direction is always the one the search would return, so the game plays the same either way.
+     */
+    void SetDirectionCacheEnabled(bool enabled);
+} // namespace OpenRCT2::FootpathGraph
+
 // Overall guest pathfinding AI. Sets up Peep::DestinationX/DestinationY (which they move to in a
 // straight line, no pathfinding). Called whenever the guest has arrived at their previously set destination.
 //
@@ -93,6 +93,11 @@ static constexpr const int32_t RideInspectionInterval[] = {
 
 static std::vector<Ride> _rides;
 
+// Ids of all rides in use in ascending order. Rebuilt on demand after GetOrAllocateRide() or Ride::Delete(), the only
+// places where a slot starts or stops being in use.
+static std::vector<ride_id_t> _activeRideIds;
+static bool _activeRideIdsInvalid = true;
+
 // Static function declarations
 Staff* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspection);
 static void ride_breakdown_status_update(Ride* ride);
@@ -111,17 +116,39 @@ RideManager GetRideManager()
     return {};
 }
 
-size_t RideManager::size() const
+static const std::vector<ride_id_t>& GetActiveRideIds()
 {
-    size_t count = 0;
-    for (size_t i = 0; i < _rides.size(); i++)
+    if (_activeRideIdsInvalid)
     {
-        if (_rides[i].type != RIDE_TYPE_NULL)
+        _activeRideIds.clear();
+        for (size_t i = 0; i < _rides.size(); i++)
         {
-            count++;
+            if (_rides[i].type != RIDE_TYPE_NULL)
+            {
+                _activeRideIds.push_back(static_cast<ride_id_t>(i));
+            }
         }
+        _activeRideIdsInvalid = false;
     }
-    return count;
+    return _activeRideIds;
+}
+
+size_t RideManager::size() const
+{
+    return GetActiveRideIds().size();
+}
+
+size_t RideManager::GetNextActiveIndex(size_t index, size_t endIndex)
+{
+    // Search by value rather than keeping a position so rides created or deleted while iterating are handled the
+    // same way as before.
+    const auto& activeIds = GetActiveRideIds();
+    auto it = std::upper_bound(activeIds.begin(), activeIds.end(), index, [](size_t value, ride_id_t id) {
+        return value < static_cast<size_t>(id);
+    });
+    if (it == activeIds.end())
+        return endIndex;
+    return std::min(static_cast<size_t>(*it), endIndex);
 }
 
 RideManager::Iterator RideManager::begin()
@@ -162,6 +189,7 @@ Ride* GetOrAllocateRide(ride_id_t index)
 
     auto result = &_rides[idx];
     result->id = index;
+    _activeRideIdsInvalid = true;
     return result;
 }
 
@@ -895,6 +923,7 @@ void ride_init_all()
 {
     _rides.clear();
     _rides.shrink_to_fit();
+    _activeRideIdsInvalid = true;
 }
 
 /**
@@ -5247,6 +5276,7 @@ void Ride::Delete()
     custom_name = {};
     measurement = {};
     type = RIDE_TYPE_NULL;
+    _activeRideIdsInvalid = true;
 }
 
 void Ride::Renew()
@@ -5689,7 +5719,7 @@ void ride_clear_leftover_entrances(Ride* ride)
                 if (entrance->GetRideIndex() != ride->id)
                     continue;
 
-                tile_element_remove(entrance->as<TileElement>());
+                tile_element_remove(tilePos.ToCoordsXY(), entrance->as<TileElement>());
             }
         }
     }
@@ -923,10 +923,10 @@ struct RideManager
     public:
         Iterator& operator++()
         {
-            do
+            if (_index < _endIndex)
             {
-                _index++;
-            } while (_index < _endIndex && (*_rideManager)[static_cast<ride_id_t>(_index)] == nullptr);
+                _index = RideManager::GetNextActiveIndex(_index, _endIndex);
+            }
             return *this;
         }
         Iterator operator++(int)
@@ -960,10 +960,20 @@ struct RideManager
     {
         return (const_cast<RideManager*>(this))->end();
     }
+
+private:
+    /**
+     * Returns the lowest id of a ride in use that is greater than index, or endIndex if there is none before it.
+     */
+    static size_t GetNextActiveIndex(size_t index, size_t endIndex);
 };
 
 RideManager GetRideManager();
 ride_id_t GetNextFreeRideId();
+/**
+ * Returns the ride slot for index, allocating it if needed. Assign the ride type before rides are counted or iterated
+ * again, a slot only counts as in use once it has a type.
+ */
 Ride* GetOrAllocateRide(ride_id_t index);
 rct_ride_entry* get_ride_entry(ObjectEntryIndex index);
 std::string_view get_ride_entry_name(ObjectEntryIndex index);
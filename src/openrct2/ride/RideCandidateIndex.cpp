@@ -0,0 +1,135 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RideCandidateIndex.h"
+
+#include "../Game.h"
+#include "../world/Map.h"
+#include "../world/TileElementsView.h"
+#include "Track.h"
+
+#include <vector>
+
+using namespace OpenRCT2;
+
+namespace OpenRCT2::RideCandidateIndex
+{
+    struct TileEntry
+    {
+        uint32_t Generation;
+        ride_id_t Ride;
+        bool HasMultipleRides;
+    };
+
+    // Generation 0 is never current so that fresh entries are always stale.
+    static uint32_t _generation = 1;
+    static std::vector<TileEntry> _tiles;
+
+    static uint32_t _visibleRidesGeneration;
+    static uint32_t _visibleRidesTick;
+    static BitSet<MAX_RIDES> _visibleRides;
+
+    void Invalidate()
+    {
+        _generation++;
+        if (_generation == 0)
+        {
+            // Wrapped around, old entries could look current again.
+            _tiles.clear();
+            _generation = 1;
+        }
+    }
+
+    static void AddRidesOnTile(const CoordsXY& loc, BitSet<MAX_RIDES>& rides)
+    {
+        for (auto* trackElement : TileElementsView<TrackElement>(loc))
+        {
+            auto rideIndex = trackElement->GetRideIndex();
+            if (rideIndex != RIDE_ID_NULL)
+            {
+                rides[EnumValue(rideIndex)] = true;
+            }
+        }
+    }
+
+    static const TileEntry& GetTileEntry(const TileCoordsXY& tileLoc)
+    {
+        if (_tiles.empty())
+        {
+            _tiles.resize(MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL, TileEntry{ 0, RIDE_ID_NULL, false });
+        }
+
+        auto& entry = _tiles[tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x];
+        if (entry.Generation != _generation)
+        {
+            entry.Generation = _generation;
+            entry.Ride = RIDE_ID_NULL;
+            entry.HasMultipleRides = false;
+            for (auto* trackElement : TileElementsView<TrackElement>(tileLoc.ToCoordsXY()))
+            {
+                auto rideIndex = trackElement->GetRideIndex();
+                if (rideIndex == RIDE_ID_NULL || rideIndex == entry.Ride)
+                    continue;
+
+                if (entry.Ride != RIDE_ID_NULL)
+                {
+                    entry.HasMultipleRides = true;
+                    break;
+                }
+                entry.Ride = rideIndex;
+            }
+        }
+        return entry;
+    }
+
+    void AddRidesNear(const CoordsXY& loc, int32_t radius, BitSet<MAX_RIDES>& rides)
+    {
+        const int32_t cx = floor2(loc.x, COORDS_XY_STEP);
+        const int32_t cy = floor2(loc.y, COORDS_XY_STEP);
+        for (int32_t tileX = cx - radius; tileX <= cx + radius; tileX += COORDS_XY_STEP)
+        {
+            for (int32_t tileY = cy - radius; tileY <= cy + radius; tileY += COORDS_XY_STEP)
+            {
+                auto location = CoordsXY{ tileX, tileY };
+                if (!map_is_location_valid(location))
+                    continue;
+
+                const auto& entry = GetTileEntry(TileCoordsXY(location));
+                if (entry.HasMultipleRides)
+                {
+                    AddRidesOnTile(location, rides);
+                }
+                else if (entry.Ride != RIDE_ID_NULL)
+                {
+                    rides[EnumValue(entry.Ride)] = true;
+                }
+            }
+        }
+    }
+
+    void AddVisibleRides(BitSet<MAX_RIDES>& rides)
+    {
+        // Ratings and drop heights are only updated by the ride and vehicle updates, never while guests are deciding,
+        // so the set only has to be rebuilt once per tick or when the rides changed.
+        if (_visibleRidesTick != gCurrentTicks || _visibleRidesGeneration != _generation)
+        {
+            _visibleRidesTick = gCurrentTicks;
+            _visibleRidesGeneration = _generation;
+            _visibleRides.reset();
+            for (auto& ride : GetRideManager())
+            {
+                if (ride.highest_drop_height > 66 || ride.excitement >= RIDE_RATING(8, 00))
+                {
+                    _visibleRides[EnumValue(ride.id)] = true;
+                }
+            }
+        }
+        rides |= _visibleRides;
+    }
+} // namespace OpenRCT2::RideCandidateIndex
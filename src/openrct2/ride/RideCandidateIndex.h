@@ -0,0 +1,39 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../core/BitSet.hpp"
+#include "Ride.h"
+
+#include <cstdint>
+
+/**
+ * Caches which rides have track on each tile and which rides can be seen from anywhere in the park, used by guests
+ * when picking a ride. The tile entries are validated lazily against a generation that is bumped whenever track
+ * elements may have changed, so only the tiles guests actually look at are ever rescanned.
+ */
+namespace OpenRCT2::RideCandidateIndex
+{
+    /**
+     * Marks all cached tiles as stale, call whenever track elements are added, removed or modified.
+     */
+    void Invalidate();
+
+    /**
+     * Adds every ride with a track element on a valid tile within radius (in coordinates) of loc.
+     */
+    void AddRidesNear(const CoordsXY& loc, int32_t radius, BitSet<MAX_RIDES>& rides);
+
+    /**
+     * Adds the rides that are tall or exciting enough to be considered from anywhere in the park, recomputed once per
+     * tick.
+     */
+    void AddVisibleRides(BitSet<MAX_RIDES>& rides);
+} // namespace OpenRCT2::RideCandidateIndex
@@ -12,6 +12,7 @@
 #include "../Cheats.h"
 #include "../Context.h"
 #include "../OpenRCT2.h"
+#include "../core/JobPool.h"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
 #include "../scripting/ScriptEngine.h"
@@ -25,6 +26,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -126,6 +128,54 @@ void ride_ratings_update_all()
     ride_ratings_update_state(gRideRatingUpdateState);
 }
 
+/**
+ * Rates every ride at once, each with its own state. The track walks only read the map and run on worker threads, the
+ * ratings are then calculated and stored on the calling thread in ride order so the result does not depend on the order
+ * the walks finished in. Meant for tools, the game itself still rates one ride at a time through gRideRatingUpdateState
+ * as that state is saved in the park and has to advance the same way on every client.
+ * Returns the time spent on each rated ride, in ride order.
+ */
+std::vector<RideRatingTiming> ride_ratings_update_all_instant()
+{
+    std::vector<RideRatingUpdateState> states;
+    std::vector<RideRatingTiming> timings;
+    for (auto& ride : GetRideManager())
+    {
+        if (ride.status != RideStatus::Closed && !(ride.lifecycle_flags & RIDE_LIFECYCLE_FIXED_RATINGS))
+        {
+            auto& state = states.emplace_back();
+            state.CurrentRide = ride.id;
+            state.State = RIDE_RATINGS_STATE_INITIALISE;
+            timings.push_back({ ride.id, {} });
+        }
+    }
+
+    JobPool jobPool;
+    jobPool.ParallelFor(
+        states.size(),
+        [&states, &timings](size_t index) {
+            auto startTime = std::chrono::high_resolution_clock::now();
+            auto& state = states[index];
+            while (state.State != RIDE_RATINGS_STATE_FIND_NEXT_RIDE && state.State != RIDE_RATINGS_STATE_CALCULATE)
+            {
+                ride_ratings_update_state(state);
+            }
+            timings[index].Duration = std::chrono::high_resolution_clock::now() - startTime;
+        },
+        1);
+
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        if (states[i].State == RIDE_RATINGS_STATE_CALCULATE)
+        {
+            auto startTime = std::chrono::high_resolution_clock::now();
+            ride_ratings_update_state(states[i]);
+            timings[i].Duration += std::chrono::high_resolution_clock::now() - startTime;
+        }
+    }
+    return timings;
+}
+
 static void ride_ratings_update_state(RideRatingUpdateState& state)
 {
     switch (state.State)
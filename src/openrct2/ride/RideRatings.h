@@ -13,6 +13,9 @@
 #include "../world/Location.hpp"
 #include "RideTypes.h"
 
+#include <chrono>
+#include <vector>
+
 using ride_rating = fixed16_2dp;
 using track_type_t = uint16_t;
 
@@ -54,10 +57,17 @@ struct RideRatingUpdateState
     uint16_t StationFlags;
 };
 
+struct RideRatingTiming
+{
+    ride_id_t RideId;
+    std::chrono::nanoseconds Duration;
+};
+
 extern RideRatingUpdateState gRideRatingUpdateState;
 
 void ride_ratings_update_ride(const Ride& ride);
 void ride_ratings_update_all();
+std::vector<RideRatingTiming> ride_ratings_update_all_instant();
 
 using ride_ratings_calculation = void (*)(Ride* ride, RideRatingUpdateState& state);
 ride_ratings_calculation ride_ratings_get_calculate_func(uint8_t rideType);
@@ -28,6 +28,7 @@
 #include "../world/Scenery.h"
 #include "../world/Surface.h"
 #include "Ride.h"
+#include "RideCandidateIndex.h"
 #include "RideData.h"
 #include "RideRatings.h"
 #include "Station.h"
@@ -790,6 +791,7 @@ ride_id_t TrackElement::GetRideIndex() const
 void TrackElement::SetRideIndex(ride_id_t newRideIndex)
 {
     RideIndex = newRideIndex;
+    OpenRCT2::RideCandidateIndex::Invalidate();
 }
 
 uint8_t TrackElement::GetColourScheme() const
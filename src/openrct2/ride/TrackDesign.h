@@ -237,7 +237,7 @@ void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels);
 ///////////////////////////////////////////////////////////////////////////////
 void track_design_save_init();
 void track_design_save_reset_scenery();
-bool track_design_save_contains_tile_element(const TileElement* tileElement);
+bool track_design_save_contains_tile_element(const CoordsXY& loc, const TileElement* tileElement);
 void track_design_save_select_nearby_scenery(ride_id_t rideIndex);
 void track_design_save_select_tile_element(
     ViewportInteractionItem interactionType, const CoordsXY& loc, TileElement* tileElement, bool collect);
@@ -245,4 +245,3 @@ void track_design_save_select_tile_element(
 bool track_design_are_entrance_and_exit_placed();
 
 extern std::vector<TrackDesignSceneryElement> _trackSavedTileElementsDesc;
-extern std::vector<const TileElement*> _trackSavedTileElements;
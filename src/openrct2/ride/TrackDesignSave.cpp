@@ -36,6 +36,7 @@
 #include "TrackDesignRepository.h"
 
 #include <algorithm>
+#include <optional>
 
 constexpr size_t TRACK_MAX_SAVED_TILE_ELEMENTS = 1500;
 constexpr int32_t TRACK_NEARBY_SCENERY_DISTANCE = 1;
@@ -43,7 +44,20 @@ constexpr int32_t TRACK_NEARBY_SCENERY_DISTANCE = 1;
 bool gTrackDesignSaveMode = false;
 ride_id_t gTrackDesignSaveRideIndex = RIDE_ID_NULL;
 
-std::vector<const TileElement*> _trackSavedTileElements;
+// The selected elements are kept as the tile and the index of the element on it, elements are moved in memory when the
+// map is compacted.
+struct TrackDesignSavedTileElement
+{
+    TileCoordsXY Loc;
+    int32_t Index{};
+
+    bool operator==(const TrackDesignSavedTileElement& other) const
+    {
+        return Loc == other.Loc && Index == other.Index;
+    }
+};
+
+static std::vector<TrackDesignSavedTileElement> _trackSavedTileElements;
 std::vector<TrackDesignSceneryElement> _trackSavedTileElementsDesc;
 
 struct TrackDesignAddStatus
@@ -82,7 +96,7 @@ void track_design_save_init()
 void track_design_save_select_tile_element(
     ViewportInteractionItem interactionType, const CoordsXY& loc, TileElement* tileElement, bool collect)
 {
-    if (track_design_save_contains_tile_element(tileElement))
+    if (track_design_save_contains_tile_element(loc, tileElement))
     {
         if (!collect)
         {
@@ -131,16 +145,30 @@ void track_design_save_reset_scenery()
     gfx_invalidate_screen();
 }
 
-bool track_design_save_contains_tile_element(const TileElement* tileElement)
+static std::optional<TrackDesignSavedTileElement> track_design_save_get_saved_tile_element(
+    const CoordsXY& loc, const TileElement* tileElement)
 {
-    for (auto& tile : _trackSavedTileElements)
+    const auto* element = map_get_first_element_at(loc);
+    if (element == nullptr)
+        return std::nullopt;
+
+    for (int32_t index = 0;; index++, element++)
     {
-        if (tile == tileElement)
-        {
-            return true;
-        }
+        if (element == tileElement)
+            return TrackDesignSavedTileElement{ TileCoordsXY(loc), index };
+        if (element->IsLastForTile())
+            return std::nullopt;
     }
-    return false;
+}
+
+bool track_design_save_contains_tile_element(const CoordsXY& loc, const TileElement* tileElement)
+{
+    auto savedElement = track_design_save_get_saved_tile_element(loc, tileElement);
+    if (!savedElement.has_value())
+        return false;
+
+    return std::find(_trackSavedTileElements.begin(), _trackSavedTileElements.end(), *savedElement)
+        != _trackSavedTileElements.end();
 }
 
 static int32_t tile_element_get_total_element_count(TileElement* tileElement)
@@ -201,9 +229,10 @@ static bool track_design_save_can_add_tile_element(TileElement* tileElement)
  */
 static void track_design_save_push_tile_element(const CoordsXY& loc, TileElement* tileElement)
 {
-    if (_trackSavedTileElements.size() < TRACK_MAX_SAVED_TILE_ELEMENTS)
+    auto savedElement = track_design_save_get_saved_tile_element(loc, tileElement);
+    if (savedElement.has_value() && _trackSavedTileElements.size() < TRACK_MAX_SAVED_TILE_ELEMENTS)
     {
-        _trackSavedTileElements.push_back(tileElement);
+        _trackSavedTileElements.push_back(*savedElement);
         map_invalidate_tile_full(loc);
     }
 }
@@ -416,11 +445,15 @@ static void track_design_save_pop_tile_element(const CoordsXY& loc, TileElement*
 {
     map_invalidate_tile_full(loc);
 
+    auto savedElement = track_design_save_get_saved_tile_element(loc, tileElement);
+    if (!savedElement.has_value())
+        return;
+
     // Find index of map element to remove
     size_t removeIndex = SIZE_MAX;
     for (size_t i = 0; i < _trackSavedTileElements.size(); i++)
     {
-        if (_trackSavedTileElements[i] == tileElement)
+        if (_trackSavedTileElements[i] == *savedElement)
         {
             removeIndex = i;
         }
@@ -647,9 +680,10 @@ static void track_design_save_select_nearby_scenery_for_tile(ride_id_t rideIndex
 
                 if (interactionType != ViewportInteractionItem::None)
                 {
-                    if (!track_design_save_contains_tile_element(tileElement))
+                    auto loc = TileCoordsXY(x, y).ToCoordsXY();
+                    if (!track_design_save_contains_tile_element(loc, tileElement))
                     {
-                        track_design_save_add_tile_element(interactionType, TileCoordsXY(x, y).ToCoordsXY(), tileElement);
+                        track_design_save_add_tile_element(interactionType, loc, tileElement);
                     }
                 }
             } while (!(tileElement++)->IsLastForTile());
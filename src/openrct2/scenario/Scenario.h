@@ -21,6 +21,8 @@
 #include "../world/Map.h"
 #include "../world/MapAnimation.h"
 
+#include <functional>
+
 using random_engine_t = Random::Rct2::Engine;
 
 enum
@@ -180,6 +182,12 @@ uint32_t scenario_rand_max(uint32_t max);
 
 bool scenario_prepare_for_save();
 int32_t scenario_save(const utf8* path, int32_t flags);
+
+/**
+ * Serialises the park like an automatic scenario_save(). The returned function compresses the data and writes it to
+ * path without accessing the game state, so it can be called on another thread. It returns false on failure.
+ */
+std::function<bool()> scenario_save_deferred(const utf8* path);
 void scenario_failure();
 void scenario_success();
 void scenario_success_submit_name(const char* name);
@@ -15,6 +15,8 @@
 #    include "../../../common.h"
 #    include "../../../core/Guard.hpp"
 #    include "../../../entity/EntityRegistry.h"
+#    include "../../../peep/GuestPathfinding.h"
+#    include "../../../ride/RideCandidateIndex.h"
 #    include "../../../ride/Track.h"
 #    include "../../../world/Footpath.h"
 #    include "../../../world/Scenery.h"
@@ -125,6 +127,8 @@ namespace OpenRCT2::Scripting
                     first[numElements - 1].SetLastForTile(true);
                 }
             }
+            RideCandidateIndex::Invalidate();
+            FootpathGraph::InvalidateTile(_coords);
             map_invalidate_tile_full(_coords);
         }
     }
@@ -177,6 +181,8 @@ namespace OpenRCT2::Scripting
                     first[i].SetLastForTile(false);
                 }
                 first[origNumElements].SetLastForTile(true);
+                // The new element is a blank surface, the footpath graph does not change.
+                RideCandidateIndex::Invalidate();
                 map_invalidate_tile_full(_coords);
                 result = std::make_shared<ScTileElement>(_coords, &first[index]);
             }
@@ -195,7 +201,7 @@ namespace OpenRCT2::Scripting
         auto first = GetFirstElement();
         if (index < GetNumElements(first))
         {
-            tile_element_remove(&first[index]);
+            tile_element_remove(_coords, &first[index]);
             map_invalidate_tile_full(_coords);
         }
     }
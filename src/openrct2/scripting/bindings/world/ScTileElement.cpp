@@ -15,7 +15,9 @@
 #    include "../../../common.h"
 #    include "../../../core/Guard.hpp"
 #    include "../../../entity/EntityRegistry.h"
+#    include "../../../peep/GuestPathfinding.h"
 #    include "../../../ride/Ride.h"
+#    include "../../../ride/RideCandidateIndex.h"
 #    include "../../../ride/Track.h"
 #    include "../../../world/Footpath.h"
 #    include "../../../world/Scenery.h"
@@ -31,13 +33,13 @@ namespace OpenRCT2::Scripting
 {
     ScTileElement::ScTileElement(const CoordsXY& coords, TileElement* element)
         : _coords(coords)
-        , _element(element)
+        , _index(element - map_get_first_element_at(coords))
     {
     }
 
     std::string ScTileElement::type_get() const
     {
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Surface:
                 return "surface";
@@ -62,22 +64,28 @@ namespace OpenRCT2::Scripting
 
     void ScTileElement::type_set(std::string value)
     {
+        // Invalidate() only sees the new type, so an element leaving the footpath graph is dropped here.
+        if (FootpathGraph::UsesElementType(GetElement()->GetType()))
+        {
+            FootpathGraph::InvalidateTile(_coords);
+        }
+
         if (value == "surface")
-            _element->SetType(TileElementType::Surface);
+            GetElement()->SetType(TileElementType::Surface);
         else if (value == "footpath")
-            _element->SetType(TileElementType::Path);
+            GetElement()->SetType(TileElementType::Path);
         else if (value == "track")
-            _element->SetType(TileElementType::Track);
+            GetElement()->SetType(TileElementType::Track);
         else if (value == "small_scenery")
-            _element->SetType(TileElementType::SmallScenery);
+            GetElement()->SetType(TileElementType::SmallScenery);
         else if (value == "entrance")
-            _element->SetType(TileElementType::Entrance);
+            GetElement()->SetType(TileElementType::Entrance);
         else if (value == "wall")
-            _element->SetType(TileElementType::Wall);
+            GetElement()->SetType(TileElementType::Wall);
         else if (value == "large_scenery")
-            _element->SetType(TileElementType::LargeScenery);
+            GetElement()->SetType(TileElementType::LargeScenery);
         else if (value == "banner")
-            _element->SetType(TileElementType::Banner);
+            GetElement()->SetType(TileElementType::Banner);
         else
         {
             std::puts("Element type not recognised!");
@@ -89,62 +97,62 @@ namespace OpenRCT2::Scripting
 
     uint8_t ScTileElement::baseHeight_get() const
     {
-        return _element->base_height;
+        return GetElement()->base_height;
     }
     void ScTileElement::baseHeight_set(uint8_t newBaseHeight)
     {
         ThrowIfGameStateNotMutable();
-        _element->base_height = newBaseHeight;
+        GetElement()->base_height = newBaseHeight;
         Invalidate();
     }
 
     uint16_t ScTileElement::baseZ_get() const
     {
-        return _element->GetBaseZ();
+        return GetElement()->GetBaseZ();
     }
     void ScTileElement::baseZ_set(uint16_t value)
     {
         ThrowIfGameStateNotMutable();
-        _element->SetBaseZ(value);
+        GetElement()->SetBaseZ(value);
         Invalidate();
     }
 
     uint8_t ScTileElement::clearanceHeight_get() const
     {
-        return _element->clearance_height;
+        return GetElement()->clearance_height;
     }
     void ScTileElement::clearanceHeight_set(uint8_t newClearanceHeight)
     {
         ThrowIfGameStateNotMutable();
-        _element->clearance_height = newClearanceHeight;
+        GetElement()->clearance_height = newClearanceHeight;
         Invalidate();
     }
 
     uint16_t ScTileElement::clearanceZ_get() const
     {
-        return _element->GetClearanceZ();
+        return GetElement()->GetClearanceZ();
     }
     void ScTileElement::clearanceZ_set(uint16_t value)
     {
         ThrowIfGameStateNotMutable();
-        _element->SetClearanceZ(value);
+        GetElement()->SetClearanceZ(value);
         Invalidate();
     }
 
     DukValue ScTileElement::slope_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Surface:
             {
-                auto el = _element->AsSurface();
+                auto el = GetElement()->AsSurface();
                 duk_push_int(ctx, el->GetSlope());
                 break;
             }
             case TileElementType::Wall:
             {
-                auto el = _element->AsWall();
+                auto el = GetElement()->AsWall();
                 duk_push_int(ctx, el->GetSlope());
                 break;
             }
@@ -159,17 +167,17 @@ namespace OpenRCT2::Scripting
     void ScTileElement::slope_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        const auto type = _element->GetType();
+        const auto type = GetElement()->GetType();
 
         if (type == TileElementType::Surface)
         {
-            auto el = _element->AsSurface();
+            auto el = GetElement()->AsSurface();
             el->SetSlope(value);
             Invalidate();
         }
         else if (type == TileElementType::Wall)
         {
-            auto el = _element->AsWall();
+            auto el = GetElement()->AsWall();
             el->SetSlope(value);
             Invalidate();
         }
@@ -178,7 +186,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::waterHeight_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
             duk_push_int(ctx, el->GetWaterHeight());
         else
@@ -188,7 +196,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::waterHeight_set(int32_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             el->SetWaterHeight(value);
@@ -199,7 +207,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::surfaceStyle_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
             duk_push_int(ctx, el->GetSurfaceStyle());
         else
@@ -209,7 +217,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::surfaceStyle_set(uint32_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             el->SetSurfaceStyle(value);
@@ -220,7 +228,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::edgeStyle_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
             duk_push_int(ctx, el->GetEdgeStyle());
         else
@@ -230,7 +238,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::edgeStyle_set(uint32_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             el->SetEdgeStyle(value);
@@ -241,7 +249,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::grassLength_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
             duk_push_int(ctx, el->GetGrassLength());
         else
@@ -251,7 +259,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::grassLength_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             // TODO: Give warning when value > GRASS_LENGTH_CLUMPS_2
@@ -263,7 +271,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::hasOwnership_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
             duk_push_boolean(ctx, el->GetOwnership() & OWNERSHIP_OWNED);
         else
@@ -274,7 +282,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::hasConstructionRights_get()
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             auto ownership = el->GetOwnership();
@@ -288,7 +296,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::ownership_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
             duk_push_int(ctx, el->GetOwnership());
         else
@@ -298,7 +306,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::ownership_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             el->SetOwnership(value);
@@ -309,7 +317,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::parkFences_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
             duk_push_int(ctx, el->GetParkFences());
         else
@@ -319,7 +327,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::parkFences_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsSurface();
+        auto el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             el->SetParkFences(value);
@@ -330,7 +338,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::trackType_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr)
             duk_push_int(ctx, el->GetTrackType());
         else
@@ -340,7 +348,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::trackType_set(uint16_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr)
         {
             el->SetTrackType(value);
@@ -351,7 +359,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::rideType_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr)
             duk_push_int(ctx, el->GetRideType());
         else
@@ -363,7 +371,7 @@ namespace OpenRCT2::Scripting
         ThrowIfGameStateNotMutable();
         if (value < RIDE_TYPE_COUNT)
         {
-            auto el = _element->AsTrack();
+            auto el = GetElement()->AsTrack();
             if (el != nullptr)
             {
                 el->SetRideType(value);
@@ -375,17 +383,17 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::sequence_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::LargeScenery:
             {
-                auto el = _element->AsLargeScenery();
+                auto el = GetElement()->AsLargeScenery();
                 duk_push_int(ctx, el->GetSequenceIndex());
                 break;
             }
             case TileElementType::Track:
             {
-                auto el = _element->AsTrack();
+                auto el = GetElement()->AsTrack();
                 if (get_ride(el->GetRideIndex())->type != RIDE_TYPE_MAZE)
                     duk_push_int(ctx, el->GetSequenceIndex());
                 else
@@ -394,7 +402,7 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::Entrance:
             {
-                auto el = _element->AsEntrance();
+                auto el = GetElement()->AsEntrance();
                 duk_push_int(ctx, el->GetSequenceIndex());
                 break;
             }
@@ -411,18 +419,18 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::NUMBER)
         {
             ThrowIfGameStateNotMutable();
-            switch (_element->GetType())
+            switch (GetElement()->GetType())
             {
                 case TileElementType::LargeScenery:
                 {
-                    auto el = _element->AsLargeScenery();
+                    auto el = GetElement()->AsLargeScenery();
                     el->SetSequenceIndex(value.as_uint());
                     Invalidate();
                     break;
                 }
                 case TileElementType::Track:
                 {
-                    auto el = _element->AsTrack();
+                    auto el = GetElement()->AsTrack();
                     if (get_ride(el->GetRideIndex())->type != RIDE_TYPE_MAZE)
                     {
                         el->SetSequenceIndex(value.as_uint());
@@ -432,7 +440,7 @@ namespace OpenRCT2::Scripting
                 }
                 case TileElementType::Entrance:
                 {
-                    auto el = _element->AsEntrance();
+                    auto el = GetElement()->AsEntrance();
                     el->SetSequenceIndex(value.as_uint());
                     Invalidate();
                     break;
@@ -446,11 +454,11 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::ride_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Path:
             {
-                auto el = _element->AsPath();
+                auto el = GetElement()->AsPath();
                 if (el->IsQueue() && el->GetRideIndex() != RIDE_ID_NULL)
                     duk_push_int(ctx, EnumValue(el->GetRideIndex()));
                 else
@@ -459,13 +467,13 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::Track:
             {
-                auto el = _element->AsTrack();
+                auto el = GetElement()->AsTrack();
                 duk_push_int(ctx, EnumValue(el->GetRideIndex()));
                 break;
             }
             case TileElementType::Entrance:
             {
-                auto el = _element->AsEntrance();
+                auto el = GetElement()->AsEntrance();
                 duk_push_int(ctx, EnumValue(el->GetRideIndex()));
                 break;
             }
@@ -480,11 +488,11 @@ namespace OpenRCT2::Scripting
     void ScTileElement::ride_set(const DukValue& value)
     {
         ThrowIfGameStateNotMutable();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Path:
             {
-                auto el = _element->AsPath();
+                auto el = GetElement()->AsPath();
                 if (el->IsQueue())
                 {
                     if (value.type() == DukValue::Type::NUMBER)
@@ -499,7 +507,7 @@ namespace OpenRCT2::Scripting
             {
                 if (value.type() == DukValue::Type::NUMBER)
                 {
-                    auto el = _element->AsTrack();
+                    auto el = GetElement()->AsTrack();
                     el->SetRideIndex(static_cast<ride_id_t>(value.as_uint()));
                     Invalidate();
                 }
@@ -509,7 +517,7 @@ namespace OpenRCT2::Scripting
             {
                 if (value.type() == DukValue::Type::NUMBER)
                 {
-                    auto el = _element->AsEntrance();
+                    auto el = GetElement()->AsEntrance();
                     el->SetRideIndex(static_cast<ride_id_t>(value.as_uint()));
                     Invalidate();
                 }
@@ -523,11 +531,11 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::station_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Path:
             {
-                auto el = _element->AsPath();
+                auto el = GetElement()->AsPath();
                 if (el->IsQueue() && el->GetRideIndex() != RIDE_ID_NULL && el->GetStationIndex() != STATION_INDEX_NULL)
                     duk_push_int(ctx, el->GetStationIndex());
                 else
@@ -536,7 +544,7 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::Track:
             {
-                auto el = _element->AsTrack();
+                auto el = GetElement()->AsTrack();
                 if (el->IsStation())
                     duk_push_int(ctx, el->GetStationIndex());
                 else
@@ -545,7 +553,7 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::Entrance:
             {
-                auto el = _element->AsEntrance();
+                auto el = GetElement()->AsEntrance();
                 duk_push_int(ctx, el->GetStationIndex());
                 break;
             }
@@ -560,11 +568,11 @@ namespace OpenRCT2::Scripting
     void ScTileElement::station_set(const DukValue& value)
     {
         ThrowIfGameStateNotMutable();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Path:
             {
-                auto el = _element->AsPath();
+                auto el = GetElement()->AsPath();
                 if (value.type() == DukValue::Type::NUMBER)
                     el->SetStationIndex(value.as_uint());
                 else
@@ -576,7 +584,7 @@ namespace OpenRCT2::Scripting
             {
                 if (value.type() == DukValue::Type::NUMBER)
                 {
-                    auto el = _element->AsTrack();
+                    auto el = GetElement()->AsTrack();
                     el->SetStationIndex(value.as_uint());
                     Invalidate();
                 }
@@ -586,7 +594,7 @@ namespace OpenRCT2::Scripting
             {
                 if (value.type() == DukValue::Type::NUMBER)
                 {
-                    auto el = _element->AsEntrance();
+                    auto el = GetElement()->AsEntrance();
                     el->SetStationIndex(value.as_uint());
                     Invalidate();
                 }
@@ -600,7 +608,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::hasChainLift_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr)
             duk_push_boolean(ctx, el->HasChain());
         else
@@ -610,7 +618,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::hasChainLift_set(bool value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr)
         {
             el->SetHasChain(value);
@@ -621,7 +629,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::mazeEntry_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr && get_ride(el->GetRideIndex())->type == RIDE_TYPE_MAZE)
             duk_push_int(ctx, el->GetMazeEntry());
         else
@@ -633,7 +641,7 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::NUMBER)
         {
             ThrowIfGameStateNotMutable();
-            auto el = _element->AsTrack();
+            auto el = GetElement()->AsTrack();
             if (el != nullptr)
             {
                 if (get_ride(el->GetRideIndex())->type == RIDE_TYPE_MAZE)
@@ -648,7 +656,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::colourScheme_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr && get_ride(el->GetRideIndex())->type != RIDE_TYPE_MAZE)
             duk_push_int(ctx, el->GetColourScheme());
         else
@@ -660,7 +668,7 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::NUMBER)
         {
             ThrowIfGameStateNotMutable();
-            auto el = _element->AsTrack();
+            auto el = GetElement()->AsTrack();
             if (el != nullptr)
             {
                 if (get_ride(el->GetRideIndex())->type != RIDE_TYPE_MAZE)
@@ -675,7 +683,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::seatRotation_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr && get_ride(el->GetRideIndex())->type != RIDE_TYPE_MAZE)
             duk_push_int(ctx, el->GetSeatRotation());
         else
@@ -687,7 +695,7 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::NUMBER)
         {
             ThrowIfGameStateNotMutable();
-            auto el = _element->AsTrack();
+            auto el = GetElement()->AsTrack();
             if (el != nullptr)
             {
                 if (get_ride(el->GetRideIndex())->type != RIDE_TYPE_MAZE)
@@ -702,7 +710,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::brakeBoosterSpeed_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr && TrackTypeHasSpeedSetting(el->GetTrackType()))
             duk_push_int(ctx, el->GetBrakeBoosterSpeed());
         else
@@ -714,7 +722,7 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::NUMBER)
         {
             ThrowIfGameStateNotMutable();
-            auto el = _element->AsTrack();
+            auto el = GetElement()->AsTrack();
             if (el != nullptr)
             {
                 if (TrackTypeHasSpeedSetting(el->GetTrackType()))
@@ -729,7 +737,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::isInverted_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr)
             duk_push_boolean(ctx, el->IsInverted());
         else
@@ -739,7 +747,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::isInverted_set(bool value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr)
         {
             el->SetInverted(value);
@@ -750,7 +758,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::hasCableLift_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr)
             duk_push_boolean(ctx, el->HasCableLift());
         else
@@ -760,7 +768,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::hasCableLift_set(bool value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr)
         {
             el->SetHasCableLift(value);
@@ -771,11 +779,11 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::object_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Path:
             {
-                auto el = _element->AsPath();
+                auto el = GetElement()->AsPath();
                 auto index = el->GetLegacyPathEntryIndex();
                 if (index != OBJECT_ENTRY_INDEX_NULL)
                     duk_push_int(ctx, index);
@@ -785,25 +793,25 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::SmallScenery:
             {
-                auto el = _element->AsSmallScenery();
+                auto el = GetElement()->AsSmallScenery();
                 duk_push_int(ctx, el->GetEntryIndex());
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto el = _element->AsLargeScenery();
+                auto el = GetElement()->AsLargeScenery();
                 duk_push_int(ctx, el->GetEntryIndex());
                 break;
             }
             case TileElementType::Wall:
             {
-                auto el = _element->AsWall();
+                auto el = GetElement()->AsWall();
                 duk_push_int(ctx, el->GetEntryIndex());
                 break;
             }
             case TileElementType::Entrance:
             {
-                auto el = _element->AsEntrance();
+                auto el = GetElement()->AsEntrance();
                 duk_push_int(ctx, el->GetEntranceType());
                 break;
             }
@@ -821,13 +829,13 @@ namespace OpenRCT2::Scripting
         ThrowIfGameStateNotMutable();
 
         auto index = FromDuk<ObjectEntryIndex>(value);
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Path:
             {
                 if (value.type() == DukValue::Type::NUMBER)
                 {
-                    auto el = _element->AsPath();
+                    auto el = GetElement()->AsPath();
                     el->SetLegacyPathEntryIndex(index);
                     Invalidate();
                 }
@@ -835,28 +843,28 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::SmallScenery:
             {
-                auto el = _element->AsSmallScenery();
+                auto el = GetElement()->AsSmallScenery();
                 el->SetEntryIndex(index);
                 Invalidate();
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto el = _element->AsLargeScenery();
+                auto el = GetElement()->AsLargeScenery();
                 el->SetEntryIndex(index);
                 Invalidate();
                 break;
             }
             case TileElementType::Wall:
             {
-                auto el = _element->AsWall();
+                auto el = GetElement()->AsWall();
                 el->SetEntryIndex(index);
                 Invalidate();
                 break;
             }
             case TileElementType::Entrance:
             {
-                auto el = _element->AsEntrance();
+                auto el = GetElement()->AsEntrance();
                 el->SetEntranceType(index);
                 Invalidate();
                 break;
@@ -868,20 +876,20 @@ namespace OpenRCT2::Scripting
 
     bool ScTileElement::isHidden_get() const
     {
-        return _element->IsInvisible();
+        return GetElement()->IsInvisible();
     }
 
     void ScTileElement::isHidden_set(bool hide)
     {
         ThrowIfGameStateNotMutable();
-        _element->SetInvisible(hide);
+        GetElement()->SetInvisible(hide);
         Invalidate();
     }
 
     DukValue ScTileElement::age_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsSmallScenery();
+        auto el = GetElement()->AsSmallScenery();
         if (el != nullptr)
             duk_push_int(ctx, el->GetAge());
         else
@@ -891,7 +899,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::age_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsSmallScenery();
+        auto el = GetElement()->AsSmallScenery();
         if (el != nullptr)
         {
             el->SetAge(value);
@@ -902,7 +910,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::quadrant_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsSmallScenery();
+        auto el = GetElement()->AsSmallScenery();
         if (el != nullptr)
             duk_push_int(ctx, el->GetSceneryQuadrant());
         else
@@ -912,7 +920,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::quadrant_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsSmallScenery();
+        auto el = GetElement()->AsSmallScenery();
         if (el != nullptr)
         {
             el->SetSceneryQuadrant(value);
@@ -922,46 +930,46 @@ namespace OpenRCT2::Scripting
 
     uint8_t ScTileElement::occupiedQuadrants_get() const
     {
-        return _element->GetOccupiedQuadrants();
+        return GetElement()->GetOccupiedQuadrants();
     }
     void ScTileElement::occupiedQuadrants_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        _element->SetOccupiedQuadrants(value);
+        GetElement()->SetOccupiedQuadrants(value);
         Invalidate();
     }
 
     bool ScTileElement::isGhost_get() const
     {
-        return _element->IsGhost();
+        return GetElement()->IsGhost();
     }
     void ScTileElement::isGhost_set(bool value)
     {
         ThrowIfGameStateNotMutable();
-        _element->SetGhost(value);
+        GetElement()->SetGhost(value);
         Invalidate();
     }
 
     DukValue ScTileElement::primaryColour_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::SmallScenery:
             {
-                auto el = _element->AsSmallScenery();
+                auto el = GetElement()->AsSmallScenery();
                 duk_push_int(ctx, el->GetPrimaryColour());
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto el = _element->AsLargeScenery();
+                auto el = GetElement()->AsLargeScenery();
                 duk_push_int(ctx, el->GetPrimaryColour());
                 break;
             }
             case TileElementType::Wall:
             {
-                auto el = _element->AsWall();
+                auto el = GetElement()->AsWall();
                 duk_push_int(ctx, el->GetPrimaryColour());
                 break;
             }
@@ -976,25 +984,25 @@ namespace OpenRCT2::Scripting
     void ScTileElement::primaryColour_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::SmallScenery:
             {
-                auto el = _element->AsSmallScenery();
+                auto el = GetElement()->AsSmallScenery();
                 el->SetPrimaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto el = _element->AsLargeScenery();
+                auto el = GetElement()->AsLargeScenery();
                 el->SetPrimaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::Wall:
             {
-                auto el = _element->AsWall();
+                auto el = GetElement()->AsWall();
                 el->SetPrimaryColour(value);
                 Invalidate();
                 break;
@@ -1007,23 +1015,23 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::secondaryColour_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::SmallScenery:
             {
-                auto el = _element->AsSmallScenery();
+                auto el = GetElement()->AsSmallScenery();
                 duk_push_int(ctx, el->GetSecondaryColour());
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto el = _element->AsLargeScenery();
+                auto el = GetElement()->AsLargeScenery();
                 duk_push_int(ctx, el->GetSecondaryColour());
                 break;
             }
             case TileElementType::Wall:
             {
-                auto el = _element->AsWall();
+                auto el = GetElement()->AsWall();
                 duk_push_int(ctx, el->GetSecondaryColour());
                 break;
             }
@@ -1038,25 +1046,25 @@ namespace OpenRCT2::Scripting
     void ScTileElement::secondaryColour_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::SmallScenery:
             {
-                auto el = _element->AsSmallScenery();
+                auto el = GetElement()->AsSmallScenery();
                 el->SetSecondaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto el = _element->AsLargeScenery();
+                auto el = GetElement()->AsLargeScenery();
                 el->SetSecondaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::Wall:
             {
-                auto el = _element->AsWall();
+                auto el = GetElement()->AsWall();
                 el->SetSecondaryColour(value);
                 Invalidate();
                 break;
@@ -1069,7 +1077,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::tertiaryColour_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsWall();
+        auto el = GetElement()->AsWall();
         if (el != nullptr)
             duk_push_int(ctx, el->GetTertiaryColour());
         else
@@ -1079,7 +1087,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::tertiaryColour_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsWall();
+        auto el = GetElement()->AsWall();
         if (el != nullptr)
         {
             el->SetTertiaryColour(value);
@@ -1090,7 +1098,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::bannerIndex_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        BannerIndex idx = _element->GetBannerIndex();
+        BannerIndex idx = GetElement()->GetBannerIndex();
         if (idx == BannerIndex::GetNull())
             duk_push_null(ctx);
         else
@@ -1100,11 +1108,11 @@ namespace OpenRCT2::Scripting
     void ScTileElement::bannerIndex_set(const DukValue& value)
     {
         ThrowIfGameStateNotMutable();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::LargeScenery:
             {
-                auto el = _element->AsLargeScenery();
+                auto el = GetElement()->AsLargeScenery();
                 if (value.type() == DukValue::Type::NUMBER)
                     el->SetBannerIndex(BannerIndex::FromUnderlying(value.as_uint()));
                 else
@@ -1114,7 +1122,7 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::Wall:
             {
-                auto el = _element->AsWall();
+                auto el = GetElement()->AsWall();
                 if (value.type() == DukValue::Type::NUMBER)
                     el->SetBannerIndex(BannerIndex::FromUnderlying(value.as_uint()));
                 else
@@ -1124,7 +1132,7 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::Banner:
             {
-                auto el = _element->AsBanner();
+                auto el = GetElement()->AsBanner();
                 if (value.type() == DukValue::Type::NUMBER)
                     el->SetIndex(BannerIndex::FromUnderlying(value.as_uint()));
                 else
@@ -1142,14 +1150,14 @@ namespace OpenRCT2::Scripting
     /** @deprecated */
     uint8_t ScTileElement::edgesAndCorners_get() const
     {
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         return el != nullptr ? el->GetEdgesAndCorners() : 0;
     }
     /** @deprecated */
     void ScTileElement::edgesAndCorners_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetEdgesAndCorners(value);
@@ -1160,7 +1168,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::edges_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
             duk_push_int(ctx, el->GetEdges());
         else
@@ -1170,7 +1178,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::edges_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetEdges(value);
@@ -1181,7 +1189,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::corners_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
             duk_push_int(ctx, el->GetCorners());
         else
@@ -1191,7 +1199,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::corners_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetCorners(value);
@@ -1202,7 +1210,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::slopeDirection_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr && el->IsSloped())
             duk_push_int(ctx, el->GetSlopeDirection());
         else
@@ -1212,7 +1220,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::slopeDirection_set(const DukValue& value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
         {
             if (value.type() == DukValue::Type::NUMBER)
@@ -1232,7 +1240,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::isQueue_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
             duk_push_boolean(ctx, el->IsQueue());
         else
@@ -1242,7 +1250,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::isQueue_set(bool value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetIsQueue(value);
@@ -1253,7 +1261,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::queueBannerDirection_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr && el->HasQueueBanner())
             duk_push_int(ctx, el->GetQueueBannerDirection());
         else
@@ -1263,7 +1271,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::queueBannerDirection_set(const DukValue& value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
         {
             if (value.type() == DukValue::Type::NUMBER)
@@ -1283,7 +1291,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::isBlockedByVehicle_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
             duk_push_boolean(ctx, el->IsBlockedByVehicle());
         else
@@ -1293,7 +1301,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::isBlockedByVehicle_set(bool value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetIsBlockedByVehicle(value);
@@ -1304,7 +1312,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::isWide_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
             duk_push_boolean(ctx, el->IsWide());
         else
@@ -1314,7 +1322,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::isWide_set(bool value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetWide(value);
@@ -1325,9 +1333,9 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::surfaceObject_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        if (_element->GetType() == TileElementType::Path)
+        if (GetElement()->GetType() == TileElementType::Path)
         {
-            auto el = _element->AsPath();
+            auto el = GetElement()->AsPath();
             auto index = el->GetSurfaceEntryIndex();
             if (index != OBJECT_ENTRY_INDEX_NULL)
             {
@@ -1350,9 +1358,9 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::NUMBER)
         {
             ThrowIfGameStateNotMutable();
-            if (_element->GetType() == TileElementType::Path)
+            if (GetElement()->GetType() == TileElementType::Path)
             {
-                auto el = _element->AsPath();
+                auto el = GetElement()->AsPath();
                 el->SetSurfaceEntryIndex(FromDuk<ObjectEntryIndex>(value));
                 Invalidate();
             }
@@ -1362,9 +1370,9 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::railingsObject_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        if (_element->GetType() == TileElementType::Path)
+        if (GetElement()->GetType() == TileElementType::Path)
         {
-            auto el = _element->AsPath();
+            auto el = GetElement()->AsPath();
             auto index = el->GetRailingsEntryIndex();
             if (index != OBJECT_ENTRY_INDEX_NULL)
             {
@@ -1387,9 +1395,9 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::NUMBER)
         {
             ThrowIfGameStateNotMutable();
-            if (_element->GetType() == TileElementType::Path)
+            if (GetElement()->GetType() == TileElementType::Path)
             {
-                auto el = _element->AsPath();
+                auto el = GetElement()->AsPath();
                 el->SetRailingsEntryIndex(FromDuk<ObjectEntryIndex>(value));
                 Invalidate();
             }
@@ -1399,7 +1407,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::addition_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr && el->HasAddition())
             duk_push_int(ctx, el->GetAddition() - 1);
         else
@@ -1409,7 +1417,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::addition_set(const DukValue& value)
     {
         ThrowIfGameStateNotMutable();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr)
         {
             if (value.type() == DukValue::Type::NUMBER)
@@ -1431,7 +1439,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::additionStatus_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr && el->HasAddition() && !el->IsQueue())
             duk_push_int(ctx, el->GetAdditionStatus());
         else
@@ -1443,7 +1451,7 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::NUMBER)
         {
             ThrowIfGameStateNotMutable();
-            auto el = _element->AsPath();
+            auto el = GetElement()->AsPath();
             if (el != nullptr)
                 if (el->HasAddition() && !el->IsQueue())
                 {
@@ -1456,7 +1464,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::isAdditionBroken_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr && el->HasAddition())
             duk_push_boolean(ctx, el->IsBroken());
         else
@@ -1468,7 +1476,7 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::BOOLEAN)
         {
             ThrowIfGameStateNotMutable();
-            auto el = _element->AsPath();
+            auto el = GetElement()->AsPath();
             if (el != nullptr)
             {
                 el->SetIsBroken(value.as_bool());
@@ -1480,7 +1488,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::isAdditionGhost_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsPath();
+        auto el = GetElement()->AsPath();
         if (el != nullptr && el->HasAddition())
             duk_push_boolean(ctx, el->AdditionIsGhost());
         else
@@ -1492,7 +1500,7 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::BOOLEAN)
         {
             ThrowIfGameStateNotMutable();
-            auto el = _element->AsPath();
+            auto el = GetElement()->AsPath();
             if (el != nullptr)
             {
                 el->SetAdditionIsGhost(value.as_bool());
@@ -1504,7 +1512,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::footpathObject_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsEntrance();
+        auto el = GetElement()->AsEntrance();
         if (el != nullptr)
         {
             auto index = el->GetLegacyPathEntryIndex();
@@ -1528,7 +1536,7 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::NUMBER)
         {
             ThrowIfGameStateNotMutable();
-            auto el = _element->AsEntrance();
+            auto el = GetElement()->AsEntrance();
             if (el != nullptr)
             {
                 el->SetLegacyPathEntryIndex(FromDuk<ObjectEntryIndex>(value));
@@ -1540,7 +1548,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::footpathSurfaceObject_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsEntrance();
+        auto el = GetElement()->AsEntrance();
         if (el != nullptr)
         {
             auto index = el->GetSurfaceEntryIndex();
@@ -1565,7 +1573,7 @@ namespace OpenRCT2::Scripting
         if (value.type() == DukValue::Type::NUMBER)
         {
             ThrowIfGameStateNotMutable();
-            auto el = _element->AsEntrance();
+            auto el = GetElement()->AsEntrance();
             if (el != nullptr)
             {
                 el->SetSurfaceEntryIndex(FromDuk<ObjectEntryIndex>(value));
@@ -1577,11 +1585,11 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::direction_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Banner:
             {
-                auto el = _element->AsBanner();
+                auto el = GetElement()->AsBanner();
                 duk_push_int(ctx, el->GetPosition());
                 break;
             }
@@ -1593,7 +1601,7 @@ namespace OpenRCT2::Scripting
             }
             default:
             {
-                duk_push_int(ctx, _element->GetDirection());
+                duk_push_int(ctx, GetElement()->GetDirection());
                 break;
             }
         }
@@ -1602,11 +1610,11 @@ namespace OpenRCT2::Scripting
     void ScTileElement::direction_set(uint8_t value)
     {
         ThrowIfGameStateNotMutable();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Banner:
             {
-                auto el = _element->AsBanner();
+                auto el = GetElement()->AsBanner();
                 el->SetPosition(value);
                 Invalidate();
                 break;
@@ -1618,14 +1626,35 @@ namespace OpenRCT2::Scripting
             }
             default:
             {
-                _element->SetDirection(value);
+                GetElement()->SetDirection(value);
                 Invalidate();
             }
         }
     }
 
+    TileElement* ScTileElement::GetElement() const
+    {
+        auto* element = map_get_first_element_at(_coords);
+        for (size_t i = 0; element != nullptr && i < _index; i++)
+        {
+            if ((element++)->IsLastForTile())
+                element = nullptr;
+        }
+        if (element == nullptr)
+        {
+            auto ctx = GetContext()->GetScriptEngine().GetContext();
+            duk_error(ctx, DUK_ERR_ERROR, "Tile element no longer exists.");
+        }
+        return element;
+    }
+
     void ScTileElement::Invalidate()
     {
+        RideCandidateIndex::Invalidate();
+        if (FootpathGraph::UsesElementType(GetElement()->GetType()))
+        {
+            FootpathGraph::InvalidateTile(_coords);
+        }
         map_invalidate_tile_full(_coords);
     }
 
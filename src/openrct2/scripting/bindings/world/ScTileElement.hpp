@@ -32,7 +32,8 @@ namespace OpenRCT2::Scripting
     {
     protected:
         CoordsXY _coords;
-        TileElement* _element;
+        // Elements are moved in memory when the map is compacted, so only the position on the tile is kept.
+        size_t _index;
 
     public:
         ScTileElement(const CoordsXY& coords, TileElement* element);
@@ -199,6 +200,8 @@ namespace OpenRCT2::Scripting
         DukValue direction_get() const;
         void direction_set(uint8_t value);
 
+        TileElement* GetElement() const;
+
         void Invalidate();
 
     public:
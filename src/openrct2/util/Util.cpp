@@ -775,9 +775,10 @@ std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen)
             strm.avail_out = static_cast<uInt>(nextBlockSize);
             strm.next_out = &output[output.size() - nextBlockSize];
             const auto ret = inflate(&strm, flush);
-            if (ret == Z_STREAM_ERROR)
+            if (ret == Z_STREAM_ERROR || ret == Z_DATA_ERROR || ret == Z_NEED_DICT || ret == Z_MEM_ERROR)
             {
-                throw std::runtime_error("deflate failed with error " + std::to_string(ret));
+                inflateEnd(&strm);
+                throw std::runtime_error("inflate failed with error " + std::to_string(ret));
             }
             output.resize(output.size() - strm.avail_out);
         } while (strm.avail_out == 0);
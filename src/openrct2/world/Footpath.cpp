@@ -27,6 +27,7 @@
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
 #include "../paint/VirtualFloor.h"
+#include "../peep/GuestPathfinding.h"
 #include "../ride/RideData.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
@@ -37,10 +38,12 @@
 #include "Park.h"
 #include "Scenery.h"
 #include "Surface.h"
+#include "TileElementsView.h"
 
 #include <algorithm>
 #include <iterator>
 
+using namespace OpenRCT2;
 using namespace OpenRCT2::TrackMetaData;
 void footpath_update_queue_entrance_banner(const CoordsXY& footpathPos, TileElement* tileElement);
 
@@ -1026,6 +1029,9 @@ void footpath_connect_edges(const CoordsXY& footpathPos, TileElement* tileElemen
 
     footpath_update_queue_chains();
 
+    // Changes the edges of the paths next to the tile as well, also when a ghost is placed or removed.
+    FootpathGraph::InvalidateTile(footpathPos);
+
     neighbour_list_init(&neighbourList);
 
     footpath_update_queue_entrance_banner(footpathPos, tileElement);
@@ -1084,6 +1090,9 @@ void footpath_chain_ride_queue(
     ride_id_t rideIndex, int32_t entranceIndex, const CoordsXY& initialFootpathPos, TileElement* const initialTileElement,
     int32_t direction)
 {
+    // Sets the ride of the queue paths along the way, the pathfinding tells queues of other rides apart.
+    FootpathGraph::Invalidate();
+
     TileElement *lastPathElement, *lastQueuePathElement;
     auto tileElement = initialTileElement;
     auto curQueuePos = initialFootpathPos;
@@ -1793,6 +1802,22 @@ void PathElement::SetShouldDrawPathOverSupports(bool on)
  *  clears the wide footpath flag for all footpaths
  *  at location
  */
+/**
+ * Returns the wide flags of the first 32 path elements on the tile as a bit mask.
+ */
+static uint32_t footpath_get_wide_flags(const CoordsXY& footpathPos)
+{
+    uint32_t wideFlags = 0;
+    uint32_t bit = 1;
+    for (auto* pathElement : TileElementsView<PathElement>(footpathPos))
+    {
+        if (pathElement->IsWide())
+            wideFlags |= bit;
+        bit <<= 1;
+    }
+    return wideFlags;
+}
+
 static void footpath_clear_wide(const CoordsXY& footpathPos)
 {
     TileElement* tileElement = map_get_first_element_at(footpathPos);
@@ -1842,6 +1867,7 @@ void footpath_update_path_wide_flags(const CoordsXY& footpathPos)
     if (map_is_location_at_edge(footpathPos))
         return;
 
+    const auto wideFlags = footpath_get_wide_flags(footpathPos);
     footpath_clear_wide(footpathPos);
     /* Rather than clearing the wide flag of the following tiles and
      * checking the state of them later, leave them intact and assume
@@ -2031,6 +2057,12 @@ void footpath_update_path_wide_flags(const CoordsXY& footpathPos)
                 tileElement->AsPath()->SetWide(true);
         }
     } while (!(tileElement++)->IsLastForTile());
+
+    // Most updates leave the flags as they were, the pathfinding graph is only dropped around tiles that changed.
+    if (footpath_get_wide_flags(footpathPos) != wideFlags)
+    {
+        FootpathGraph::InvalidateTile(footpathPos);
+    }
 }
 
 bool footpath_is_blocked_by_vehicle(const TileCoordsXYZ& position)
@@ -2300,6 +2332,9 @@ void footpath_remove_edges_at(const CoordsXY& footpathPos, TileElement* tileElem
             return;
     }
 
+    // Changes the edges of the paths next to the tile as well, also when a ghost is placed or removed.
+    FootpathGraph::InvalidateTile(footpathPos);
+
     footpath_update_queue_entrance_banner(footpathPos, tileElement);
 
     bool fixCorners = false;
@@ -21,6 +21,8 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/JobPool.h"
+#include "../entity/Fountain.h"
 #include "../interface/Cursors.h"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
@@ -29,6 +31,8 @@
 #include "../network/network.h"
 #include "../object/ObjectManager.h"
 #include "../object/TerrainSurfaceObject.h"
+#include "../peep/GuestPathfinding.h"
+#include "../ride/RideCandidateIndex.h"
 #include "../ride/RideConstruction.h"
 #include "../ride/RideData.h"
 #include "../ride/Track.h"
@@ -52,8 +56,11 @@
 #include "Wall.h"
 
 #include <algorithm>
+#include <array>
+#include <functional>
 #include <iterator>
 #include <memory>
+#include <optional>
 
 using namespace OpenRCT2;
 
@@ -79,6 +86,16 @@ const TileCoordsXY TileDirectionDelta[] = {
 
 constexpr size_t MIN_TILE_ELEMENTS = 1024;
 
+// Number of 256x256 blocks from which map_update_tiles() updates the blocks in parallel.
+static constexpr size_t MapUpdateTilesParallelThreshold = 4;
+
+// Work done by MapCompactTileElements() per tick, tiles to gather and elements to move.
+static constexpr size_t CompactionTilesPerTick = 65536;
+static constexpr size_t CompactionElementsPerTick = 65536;
+
+// A compaction starts once this fraction of the capacity of the element array is no longer in use.
+static constexpr size_t CompactionUnusedFraction = 16;
+
 uint16_t gMapSelectFlags;
 uint16_t gMapSelectType;
 CoordsXY gMapSelectPositionA;
@@ -115,6 +132,23 @@ static size_t _tileElementsInUseStash;
 static int32_t _mapSizeStash;
 static int32_t _currentRotationStash;
 
+/**
+ * State of the incremental compaction of _tileElements, see MapCompactTileElements().
+ */
+struct TileElementCompaction
+{
+    // Runs of the tiles as (offset, tile index), sorted by offset once gathering is complete.
+    std::vector<std::pair<uint32_t, uint32_t>> Runs;
+    std::vector<std::pair<uint32_t, uint32_t>> OutOfOrderRuns;
+    size_t NextTile{};
+    size_t NextRun{};
+    size_t WriteIndex{};
+    // Size of the element array when the compaction started, runs added since are all at or above it.
+    size_t Limit{};
+    bool Active{};
+};
+static TileElementCompaction _compaction;
+
 void StashMap()
 {
     _tileIndexStash = std::move(_tileIndex);
@@ -122,6 +156,9 @@ void StashMap()
     _mapSizeStash = gMapSize;
     _currentRotationStash = gCurrentRotation;
     _tileElementsInUseStash = _tileElementsInUse;
+    _compaction = {};
+    RideCandidateIndex::Invalidate();
+    FootpathGraph::Invalidate();
 }
 
 void UnstashMap()
@@ -131,6 +168,9 @@ void UnstashMap()
     gMapSize = _mapSizeStash;
     gCurrentRotation = _currentRotationStash;
     _tileElementsInUse = _tileElementsInUseStash;
+    _compaction = {};
+    RideCandidateIndex::Invalidate();
+    FootpathGraph::Invalidate();
 }
 
 const std::vector<TileElement>& GetTileElements()
@@ -141,8 +181,12 @@ const std::vector<TileElement>& GetTileElements()
 void SetTileElements(std::vector<TileElement>&& tileElements)
 {
     _tileElements = std::move(tileElements);
-    _tileIndex = TilePointerIndex<TileElement>(MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data(), _tileElements.size());
+    _tileIndex = TilePointerIndex<TileElement>(
+        MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data(), _tileElements.size(), _tileElements.capacity());
     _tileElementsInUse = _tileElements.size();
+    _compaction = {};
+    RideCandidateIndex::Invalidate();
+    FootpathGraph::Invalidate();
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -162,41 +206,69 @@ static TileElement GetDefaultSurfaceElement()
     return el;
 }
 
-std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts()
+void VisitTileElementsWithoutGhosts(const std::function<void(const TileElement* elements, size_t count)>& fn)
 {
-    std::vector<TileElement> newElements;
-    newElements.reserve(std::max(MIN_TILE_ELEMENTS, _tileElements.size()));
+    static const TileElement defaultSurfaceElement = GetDefaultSurfaceElement();
     for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
         for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
         {
-            auto oldSize = newElements.size();
+            const auto* element = map_get_first_element_at(TileCoordsXY{ x, y });
+            if (element == nullptr)
+            {
+                fn(&defaultSurfaceElement, 1);
+                continue;
+            }
 
-            // Add all non-ghost elements
-            const auto* element = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
-            if (element != nullptr)
+            // Pass on consecutive non-ghost elements as one run. The last element of a run that is followed by a
+            // ghost is held back as it has to be flagged as last for the tile if only ghosts follow.
+            const TileElement* run = nullptr;
+            size_t runLength = 0;
+            std::optional<TileElement> heldElement;
+            do
             {
-                do
+                if (!element->IsGhost())
                 {
-                    if (!element->IsGhost())
-                    {
-                        newElements.push_back(*element);
-                    }
-                } while (!(element++)->IsLastForTile());
-            }
+                    if (runLength == 0)
+                        run = element;
+                    runLength++;
+                }
+                else if (runLength > 0)
+                {
+                    if (heldElement.has_value())
+                        fn(&*heldElement, 1);
+                    if (runLength > 1)
+                        fn(run, runLength - 1);
+                    heldElement = run[runLength - 1];
+                    runLength = 0;
+                }
+            } while (!(element++)->IsLastForTile());
 
-            // Insert default surface element if no elements were added
-            auto newSize = newElements.size();
-            if (oldSize == newSize)
+            if (heldElement.has_value())
             {
-                newElements.push_back(GetDefaultSurfaceElement());
+                heldElement->SetLastForTile(runLength == 0);
+                fn(&*heldElement, 1);
+            }
+            if (runLength > 0)
+            {
+                fn(run, runLength);
+            }
+            else if (!heldElement.has_value())
+            {
+                // Insert default surface element if no elements were added
+                fn(&defaultSurfaceElement, 1);
             }
-
-            // Ensure last element of tile has last flag set
-            auto& lastEl = newElements.back();
-            lastEl.SetLastForTile(true);
         }
     }
+}
+
+std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts()
+{
+    std::vector<TileElement> newElements;
+    newElements.reserve(std::max(MIN_TILE_ELEMENTS, _tileElements.size()));
+    VisitTileElementsWithoutGhosts([&newElements](const TileElement* elements, size_t count) {
+        newElements.insert(newElements.end(), elements, elements + count);
+    });
     return newElements;
 }
 
@@ -260,12 +332,121 @@ static bool map_check_free_elements_and_reorganise(size_t numElementsOnTile, siz
         }
     }
 
-    // Capacity must increase to handle the space (Note capacity can go above MAX_TILE_ELEMENTS)
-    auto newCapacity = _tileElements.capacity() * 2;
-    ReorganiseTileElements(newCapacity);
+    // Capacity must increase to handle the space (Note capacity can go above MAX_TILE_ELEMENTS). The tiles are
+    // stored as offsets so the array can simply be reallocated, the gaps are left to MapCompactTileElements().
+    auto newCapacity = std::max(MIN_TILE_ELEMENTS, _tileElements.capacity() * 2);
+    _tileElements.reserve(newCapacity);
+    _tileIndex.SetElements(_tileElements.data(), _tileElements.capacity());
     return true;
 }
 
+static TileCoordsXY GetCompactionTileCoords(size_t tileIndex)
+{
+    return TileCoordsXY{ static_cast<int32_t>(tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL),
+                         static_cast<int32_t>(tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL) };
+}
+
+static void MapCompactTileElementsGather()
+{
+    const size_t numTiles = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+    const size_t endTile = std::min(numTiles, _compaction.NextTile + CompactionTilesPerTick);
+    for (; _compaction.NextTile < endTile; _compaction.NextTile++)
+    {
+        const auto tileIndex = _compaction.NextTile;
+        auto offset = _tileIndex.GetTileOffset(GetCompactionTileCoords(tileIndex));
+        if (!offset.has_value() || *offset >= _compaction.Limit)
+        {
+            // Points outside of the array or was added after the compaction started.
+            continue;
+        }
+
+        // Tiles are mostly stored in the order they are visited, only keep those that are not apart for sorting.
+        auto run = std::make_pair(*offset, static_cast<uint32_t>(tileIndex));
+        if (_compaction.Runs.empty() || run.first > _compaction.Runs.back().first)
+            _compaction.Runs.push_back(run);
+        else
+            _compaction.OutOfOrderRuns.push_back(run);
+    }
+
+    if (_compaction.NextTile == numTiles)
+    {
+        auto& runs = _compaction.Runs;
+        auto& outOfOrderRuns = _compaction.OutOfOrderRuns;
+        std::sort(outOfOrderRuns.begin(), outOfOrderRuns.end());
+        const auto middle = runs.insert(runs.end(), outOfOrderRuns.begin(), outOfOrderRuns.end());
+        std::inplace_merge(runs.begin(), middle, runs.end());
+        outOfOrderRuns = {};
+    }
+}
+
+static void MapCompactTileElementsMove()
+{
+    size_t budget = CompactionElementsPerTick;
+    auto& runs = _compaction.Runs;
+    while (budget > 0 && _compaction.NextRun < runs.size())
+    {
+        const auto [offset, tileIndex] = runs[_compaction.NextRun++];
+        const auto tileCoords = GetCompactionTileCoords(tileIndex);
+        if (_tileIndex.GetTileOffset(tileCoords) != offset)
+        {
+            // Tile has been relocated since it was gathered, its new run is above the limit.
+            continue;
+        }
+
+        // All runs below this one have been moved already and new runs are only added above the limit, so the
+        // elements between the write index and this run are unused.
+        auto* first = &_tileElements[offset];
+        auto* last = first;
+        while (!(last++)->IsLastForTile())
+        {
+        }
+        auto* destination = &_tileElements[_compaction.WriteIndex];
+        if (destination != first)
+        {
+            std::copy(first, last, destination);
+            _tileIndex.SetTile(tileCoords, destination);
+        }
+
+        const auto count = static_cast<size_t>(last - first);
+        _compaction.WriteIndex += count;
+        budget -= std::min(budget, count);
+    }
+
+    if (_compaction.NextRun == runs.size())
+    {
+        // Everything between the write index and the limit is unused now, if no tile has been relocated to the end
+        // of the array since the compaction started the array can be shrunk.
+        if (_tileElements.size() == _compaction.Limit)
+        {
+            _tileElements.resize(_compaction.WriteIndex);
+        }
+        _compaction = {};
+    }
+}
+
+void MapCompactTileElements()
+{
+    if (!_compaction.Active)
+    {
+        const auto numUnusedElements = _tileElements.size() - std::min(_tileElements.size(), _tileElementsInUse);
+        if (numUnusedElements < std::max(MIN_TILE_ELEMENTS, _tileElements.capacity() / CompactionUnusedFraction))
+            return;
+
+        _compaction.Active = true;
+        _compaction.Limit = _tileElements.size();
+        _compaction.Runs.reserve(MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL);
+    }
+
+    if (_compaction.NextTile < MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        MapCompactTileElementsGather();
+    }
+    else
+    {
+        MapCompactTileElementsMove();
+    }
+}
+
 static size_t CountElementsOnTile(const CoordsXY& loc);
 
 bool MapCheckCapacityAndReorganise(const CoordsXY& loc, size_t numElements)
@@ -1073,11 +1254,27 @@ bool map_is_location_at_edge(const CoordsXY& loc)
 }
 
 /**
- *
- *  rct2: 0x0068B280
+ * Removes a tile element, loc is the tile of the element if the caller knows it.
  */
-void tile_element_remove(TileElement* tileElement)
+static void TileElementRemove(const std::optional<CoordsXY>& loc, TileElement* tileElement)
 {
+    if (tileElement->GetType() == TileElementType::Track)
+    {
+        RideCandidateIndex::Invalidate();
+    }
+    // Ghosts are never part of the footpath graph.
+    if (!tileElement->IsGhost() && FootpathGraph::UsesElementType(tileElement->GetType()))
+    {
+        if (loc.has_value())
+        {
+            FootpathGraph::InvalidateTile(*loc);
+        }
+        else
+        {
+            FootpathGraph::Invalidate();
+        }
+    }
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -1093,12 +1290,28 @@ void tile_element_remove(TileElement* tileElement)
     (tileElement - 1)->SetLastForTile(true);
     tileElement->base_height = MAX_ELEMENT_HEIGHT;
     _tileElementsInUse--;
-    if (tileElement == &_tileElements.back())
+
+    // While compacting the array must not shrink below its size at the start of the compaction.
+    if (tileElement == &_tileElements.back() && (!_compaction.Active || _tileElements.size() > _compaction.Limit))
     {
         _tileElements.pop_back();
     }
 }
 
+/**
+ *
+ *  rct2: 0x0068B280
+ */
+void tile_element_remove(TileElement* tileElement)
+{
+    TileElementRemove(std::nullopt, tileElement);
+}
+
+void tile_element_remove(const CoordsXY& loc, TileElement* tileElement)
+{
+    TileElementRemove(loc, tileElement);
+}
+
 /**
  *
  *  rct2: 0x00675A8E
@@ -1126,7 +1339,7 @@ void map_remove_all_rides()
             case TileElementType::Track:
                 footpath_queue_chain_reset();
                 footpath_remove_edges_at(TileCoordsXY{ it.x, it.y }.ToCoordsXY(), it.element);
-                tile_element_remove(it.element);
+                tile_element_remove(TileCoordsXY{ it.x, it.y }.ToCoordsXY(), it.element);
                 tile_element_iterator_restart_for_tile(&it);
                 break;
             default:
@@ -1226,6 +1439,61 @@ static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNew
     return &_tileElements[oldSize];
 }
 
+/**
+ * Inserts an element into the run of a tile without moving the tile, this is possible when the run is at the end of
+ * the element array and the array has room to grow. Tiles end up there after they were relocated by an insert, so
+ * further inserts on the same tile stay next to each other instead of leaving another copy of the tile behind.
+ * Returns nullptr if the tile has to be relocated.
+ */
+static TileElement* InsertTileElementInPlace(TileElement* firstElement, size_t numElementsOnTile, int32_t z)
+{
+    auto* endOfArray = _tileElements.data() + _tileElements.size();
+    if (firstElement == nullptr || firstElement + numElementsOnTile != endOfArray)
+        return nullptr;
+    if (_tileElements.size() == _tileElements.capacity() || _tileElementsInUse + 1 > MAX_TILE_ELEMENTS)
+        return nullptr;
+
+    // Does not reallocate, the capacity was checked above.
+    _tileElements.emplace_back();
+    _tileElementsInUse++;
+
+    // Move up all elements that are above the insert height
+    auto* lastElement = firstElement + numElementsOnTile;
+    auto* insertedElement = firstElement;
+    while (insertedElement != lastElement && z >= insertedElement->GetBaseZ())
+    {
+        insertedElement++;
+    }
+    std::move_backward(insertedElement, lastElement, lastElement + 1);
+
+    if (insertedElement == lastElement)
+    {
+        // No more elements above the insert element
+        (insertedElement - 1)->SetLastForTile(false);
+    }
+    return insertedElement;
+}
+
+static void InitialiseInsertedTileElement(
+    TileElement* tileElement, const CoordsXYZ& loc, int32_t occupiedQuadrants, TileElementType type, bool isLastForTile)
+{
+    tileElement->type = 0;
+    tileElement->SetType(type);
+    tileElement->SetBaseZ(loc.z);
+    tileElement->Flags = 0;
+    tileElement->SetLastForTile(isLastForTile);
+    tileElement->SetOccupiedQuadrants(occupiedQuadrants);
+    tileElement->SetClearanceZ(loc.z);
+    tileElement->owner = 0;
+    std::memset(&tileElement->pad_05, 0, sizeof(tileElement->pad_05));
+    std::memset(&tileElement->pad_08, 0, sizeof(tileElement->pad_08));
+
+    if (FootpathGraph::UsesElementType(type))
+    {
+        FootpathGraph::InvalidateTile(loc);
+    }
+}
+
 /**
  *
  *  rct2: 0x0068B1F6
@@ -1235,6 +1503,15 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
     const auto& tileLoc = TileCoordsXYZ(loc);
 
     auto numElementsOnTileOld = CountElementsOnTile(loc);
+    auto* firstElement = _tileIndex.GetFirstElementAt(tileLoc);
+    auto* inPlaceElement = InsertTileElementInPlace(firstElement, numElementsOnTileOld, loc.z);
+    if (inPlaceElement != nullptr)
+    {
+        bool isLastForTile = inPlaceElement == firstElement + numElementsOnTileOld;
+        InitialiseInsertedTileElement(inPlaceElement, loc, occupiedQuadrants, type, isLastForTile);
+        return inPlaceElement;
+    }
+
     auto* newTileElement = AllocateTileElements(numElementsOnTileOld, 1);
     auto* originalTileElement = _tileIndex.GetFirstElementAt(tileLoc);
     if (newTileElement == nullptr)
@@ -1273,16 +1550,7 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
 
     // Insert new map element
     auto* insertedElement = newTileElement;
-    newTileElement->type = 0;
-    newTileElement->SetType(type);
-    newTileElement->SetBaseZ(loc.z);
-    newTileElement->Flags = 0;
-    newTileElement->SetLastForTile(isLastForTile);
-    newTileElement->SetOccupiedQuadrants(occupiedQuadrants);
-    newTileElement->SetClearanceZ(loc.z);
-    newTileElement->owner = 0;
-    std::memset(&newTileElement->pad_05, 0, sizeof(newTileElement->pad_05));
-    std::memset(&newTileElement->pad_08, 0, sizeof(newTileElement->pad_08));
+    InitialiseInsertedTileElement(newTileElement, loc, occupiedQuadrants, type, isLastForTile);
     newTileElement++;
 
     // Insert rest of map elements above insert height
@@ -1301,9 +1569,82 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
     return insertedElement;
 }
 
+void TileUpdateEffects::SetStep(uint8_t step)
+{
+    _step = step;
+}
+
+void TileUpdateEffects::InvalidateTile(const CoordsXYRangedZ& tilePos)
+{
+    _effects.push_back({ EffectType::InvalidateTile, JumpingFountainType::Water, _step, tilePos, nullptr });
+}
+
+void TileUpdateEffects::InvalidateTileZoom1(const CoordsXYRangedZ& tilePos)
+{
+    _effects.push_back({ EffectType::InvalidateTileZoom1, JumpingFountainType::Water, _step, tilePos, nullptr });
+}
+
+void TileUpdateEffects::GrowGrassRandomly(SurfaceElement* surfaceElement)
+{
+    _effects.push_back({ EffectType::GrowGrass, JumpingFountainType::Water, _step, {}, surfaceElement->as<TileElement>() });
+}
+
+void TileUpdateEffects::StartFountain(JumpingFountainType type, const CoordsXY& pos, TileElement* tileElement)
+{
+    _effects.push_back({ EffectType::StartFountain, type, _step, { pos, 0, 0 }, tileElement });
+}
+
+void TileUpdateEffects::Apply(uint8_t step)
+{
+    for (; _applied < _effects.size() && _effects[_applied].Step == step; _applied++)
+    {
+        const auto& effect = _effects[_applied];
+        switch (effect.Type)
+        {
+            case EffectType::InvalidateTile:
+                map_invalidate_tile(effect.Pos);
+                break;
+            case EffectType::InvalidateTileZoom1:
+                map_invalidate_tile_zoom1(effect.Pos);
+                break;
+            case EffectType::GrowGrass:
+            {
+                // Random growth rate (length nibble)
+                auto* surfaceElement = effect.Element->AsSurface();
+                surfaceElement->SetGrassLength(surfaceElement->GetGrassLength() | (scenario_rand() & 0x70));
+                break;
+            }
+            case EffectType::StartFountain:
+                JumpingFountain::StartAnimation(effect.FountainType, effect.Pos, effect.Element);
+                break;
+        }
+    }
+}
+
+void TileUpdateEffects::Clear()
+{
+    _effects.clear();
+    _applied = 0;
+    _step = 0;
+}
+
+static void map_update_tile(const CoordsXY& mapPos, TileUpdateEffects& effects)
+{
+    auto* surfaceElement = map_get_surface_element_at(mapPos);
+    if (surfaceElement != nullptr)
+    {
+        surfaceElement->UpdateGrassLength(mapPos, effects);
+        scenery_update_tile(mapPos, effects);
+    }
+}
+
 /**
  * Updates grass length, scenery age and jumping fountains.
  *
+ * The 256x256 blocks of the map only touch their own tiles so they are updated in parallel on larger maps, anything
+ * that depends on the order of the update is recorded per block and applied afterwards, step by step and block by
+ * block, in the same order as the original loop.
+ *
  *  rct2: 0x006646E1
  */
 void map_update_tiles()
@@ -1313,7 +1654,9 @@ void map_update_tiles()
         return;
 
     // Update 43 more tiles (for each 256x256 block)
-    for (int32_t j = 0; j < 43; j++)
+    constexpr uint8_t NumSteps = 43;
+    std::array<TileCoordsXY, NumSteps> blockOffsets;
+    for (uint8_t j = 0; j < NumSteps; j++)
     {
         int32_t x = 0;
         int32_t y = 0;
@@ -1326,24 +1669,56 @@ void map_update_tiles()
             y = (y << 1) | (interleaved_xy & 1);
             interleaved_xy >>= 1;
         }
+        blockOffsets[j] = { x, y };
+
+        gGrassSceneryTileLoopPosition++;
+        gGrassSceneryTileLoopPosition &= 0xFFFF;
+    }
+
+    // Repeat for each 256x256 block on the map
+    const int32_t blocksPerRow = (gMapSize + 255) / 256;
+    const size_t numBlocks = static_cast<size_t>(blocksPerRow) * blocksPerRow;
+    static std::vector<TileUpdateEffects> blockEffects;
+    if (blockEffects.size() < numBlocks)
+    {
+        blockEffects.resize(numBlocks);
+    }
+
+    const auto updateBlock = [&](size_t blockIndex) {
+        const auto blockX = static_cast<int32_t>(blockIndex % blocksPerRow) * 256;
+        const auto blockY = static_cast<int32_t>(blockIndex / blocksPerRow) * 256;
+        auto& effects = blockEffects[blockIndex];
+        effects.Clear();
+        for (uint8_t j = 0; j < NumSteps; j++)
+        {
+            effects.SetStep(j);
+            map_update_tile(TileCoordsXY{ blockX + blockOffsets[j].x, blockY + blockOffsets[j].y }.ToCoordsXY(), effects);
+        }
+    };
 
-        // Repeat for each 256x256 block on the map
-        for (int32_t blockY = 0; blockY < gMapSize; blockY += 256)
+    if (numBlocks < MapUpdateTilesParallelThreshold)
+    {
+        for (size_t blockIndex = 0; blockIndex < numBlocks; blockIndex++)
         {
-            for (int32_t blockX = 0; blockX < gMapSize; blockX += 256)
-            {
-                auto mapPos = TileCoordsXY{ blockX + x, blockY + y }.ToCoordsXY();
-                auto* surfaceElement = map_get_surface_element_at(mapPos);
-                if (surfaceElement != nullptr)
-                {
-                    surfaceElement->UpdateGrassLength(mapPos);
-                    scenery_update_tile(mapPos);
-                }
-            }
+            updateBlock(blockIndex);
         }
+    }
+    else
+    {
+        // A block is only 43 tiles, handing out a task per block costs about as much as updating it. Each worker gets one
+        // batch of neighbouring blocks instead.
+        const size_t numWorkers = std::max<size_t>(1, JobPool::GetWorkerCount());
+        const size_t blocksPerTask = (numBlocks + numWorkers - 1) / numWorkers;
+        JobPool jobPool;
+        jobPool.ParallelFor(numBlocks, updateBlock, blocksPerTask);
+    }
 
-        gGrassSceneryTileLoopPosition++;
-        gGrassSceneryTileLoopPosition &= 0xFFFF;
+    for (uint8_t j = 0; j < NumSteps; j++)
+    {
+        for (size_t blockIndex = 0; blockIndex < numBlocks; blockIndex++)
+        {
+            blockEffects[blockIndex].Apply(j);
+        }
     }
 }
 
@@ -13,9 +13,12 @@
 #include "Location.hpp"
 #include "TileElement.h"
 
+#include <functional>
 #include <initializer_list>
 #include <vector>
 
+enum class JumpingFountainType : uint8_t;
+
 #define MINIMUM_LAND_HEIGHT 2
 #define MAXIMUM_LAND_HEIGHT 142
 #define MINIMUM_WATER_HEIGHT 2
@@ -151,6 +154,18 @@ void StashMap();
 void UnstashMap();
 std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts();
 
+/**
+ * Calls fn with the elements of every tile in the order they are saved, ghost elements are left out. The elements are
+ * passed in runs, a tile that has no elements left gets a default surface element.
+ */
+void VisitTileElementsWithoutGhosts(const std::function<void(const TileElement* elements, size_t count)>& fn);
+
+/**
+ * Removes the unused elements that inserting and removing elements leave behind in the element array, a bounded
+ * number of tiles per call. Moves the elements of tiles so pointers to elements are only valid within a tick.
+ */
+void MapCompactTileElements();
+
 void map_init(int32_t size);
 
 void map_count_remaining_land_rights();
@@ -185,6 +200,7 @@ bool map_is_location_in_park(const CoordsXY& coords);
 bool map_is_location_owned_or_has_rights(const CoordsXY& loc);
 bool map_surface_is_blocked(const CoordsXY& mapCoords);
 void tile_element_remove(TileElement* tileElement);
+void tile_element_remove(const CoordsXY& loc, TileElement* tileElement);
 void map_remove_all_rides();
 void map_invalidate_map_selection_tiles();
 void map_invalidate_selection_rect();
@@ -211,6 +227,53 @@ void tile_element_iterator_begin(tile_element_iterator* it);
 int32_t tile_element_iterator_next(tile_element_iterator* it);
 void tile_element_iterator_restart_for_tile(tile_element_iterator* it);
 
+/**
+ * Records the side effects of updating a tile in map_update_tiles() that can not be done while the 256x256 blocks
+ * are updated in parallel: drawing from the scenario random number generator, creating fountain entities and
+ * invalidating the viewports. They are applied on the game thread in the order the serial update would have done them.
+ */
+class TileUpdateEffects
+{
+private:
+    enum class EffectType : uint8_t
+    {
+        InvalidateTile,
+        InvalidateTileZoom1,
+        GrowGrass,
+        StartFountain,
+    };
+
+    struct Effect
+    {
+        EffectType Type;
+        JumpingFountainType FountainType;
+        uint8_t Step;
+        CoordsXYRangedZ Pos;
+        TileElement* Element;
+    };
+
+    std::vector<Effect> _effects;
+    size_t _applied{};
+    uint8_t _step{};
+
+public:
+    /**
+     * Sets the step of the tile loop that the following effects belong to.
+     */
+    void SetStep(uint8_t step);
+
+    void InvalidateTile(const CoordsXYRangedZ& tilePos);
+    void InvalidateTileZoom1(const CoordsXYRangedZ& tilePos);
+    void GrowGrassRandomly(SurfaceElement* surfaceElement);
+    void StartFountain(JumpingFountainType type, const CoordsXY& pos, TileElement* tileElement);
+
+    /**
+     * Applies the effects that were recorded for the given step, steps have to be applied in ascending order.
+     */
+    void Apply(uint8_t step);
+    void Clear();
+};
+
 void map_update_tiles();
 int32_t map_get_highest_z(const CoordsXY& loc);
 
@@ -42,6 +42,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <optional>
 
 using namespace OpenRCT2;
 
@@ -307,10 +308,14 @@ void Park::Initialise()
 
 void Park::Update(const Date& date)
 {
+    // The guests do not change before GenerateGuests(), so the rating and the weekly history share one pass over them.
+    std::optional<GuestStatistics> guestStats;
+
     // Every ~13 seconds
     if (gCurrentTicks % 512 == 0)
     {
-        gParkRating = CalculateParkRating();
+        guestStats = GetGuestStatistics();
+        gParkRating = CalculateParkRating(*guestStats);
         gParkValue = CalculateParkValue();
         gCompanyValue = CalculateCompanyValue();
         gTotalRideValueForMoney = CalculateTotalRideValueForMoney();
@@ -330,7 +335,11 @@ void Park::Update(const Date& date)
     // Every new week
     if (date.IsWeekStart())
     {
-        UpdateHistories();
+        if (!guestStats.has_value())
+        {
+            guestStats = GetGuestStatistics();
+        }
+        UpdateHistories(*guestStats);
     }
     GenerateGuests();
 }
@@ -361,6 +370,15 @@ int32_t Park::CalculateParkSize() const
 }
 
 int32_t Park::CalculateParkRating() const
+{
+    if (_forcedParkRating >= 0)
+    {
+        return _forcedParkRating;
+    }
+    return CalculateParkRating(GetGuestStatistics());
+}
+
+int32_t Park::CalculateParkRating(const GuestStatistics& guestStats) const
 {
     if (_forcedParkRating >= 0)
     {
@@ -379,22 +397,8 @@ int32_t Park::CalculateParkRating() const
         result -= 150 - (std::min<int16_t>(2000, gNumGuestsInPark) / 13);
 
         // Find the number of happy peeps and the number of peeps who can't find the park exit
-        uint32_t happyGuestCount = 0;
-        uint32_t lostGuestCount = 0;
-        for (auto peep : EntityList<Guest>())
-        {
-            if (!peep->OutsideOfPark)
-            {
-                if (peep->Happiness > 128)
-                {
-                    happyGuestCount++;
-                }
-                if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
-                {
-                    lostGuestCount++;
-                }
-            }
-        }
+        auto happyGuestCount = guestStats.HappyGuests;
+        auto lostGuestCount = guestStats.LostGuests;
 
         // Peep happiness -500 to +0
         result -= 500;
@@ -736,7 +740,7 @@ void Park::ResetHistories()
     std::fill(std::begin(gGuestsInParkHistory), std::end(gGuestsInParkHistory), GuestsInParkHistoryUndefined);
 }
 
-void Park::UpdateHistories()
+void Park::UpdateHistories(const GuestStatistics& guestStats)
 {
     uint8_t guestChangeModifier = 1;
     int32_t changeInGuestsInPark = static_cast<int32_t>(gNumGuestsInPark) - static_cast<int32_t>(gNumGuestsInParkLastWeek);
@@ -752,7 +756,7 @@ void Park::UpdateHistories()
     gNumGuestsInParkLastWeek = gNumGuestsInPark;
 
     // Update park rating, guests in park and current cash history
-    HistoryPushRecord<uint8_t, 32>(gParkRatingHistory, CalculateParkRating() / 4);
+    HistoryPushRecord<uint8_t, 32>(gParkRatingHistory, CalculateParkRating(guestStats) / 4);
     HistoryPushRecord<uint32_t, 32>(gGuestsInParkHistory, gNumGuestsInPark);
     HistoryPushRecord<money64, std::size(gCashHistory)>(gCashHistory, finance_get_current_cash() - gBankLoan);
 
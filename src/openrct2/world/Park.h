@@ -41,6 +41,7 @@ enum : uint32_t
 };
 
 struct Guest;
+struct GuestStatistics;
 struct rct_ride;
 
 namespace OpenRCT2
@@ -66,6 +67,7 @@ namespace OpenRCT2
 
         int32_t CalculateParkSize() const;
         int32_t CalculateParkRating() const;
+        int32_t CalculateParkRating(const GuestStatistics& guestStats) const;
         money64 CalculateParkValue() const;
         money64 CalculateCompanyValue() const;
         static uint8_t CalculateGuestInitialHappiness(uint8_t percentage);
@@ -73,7 +75,7 @@ namespace OpenRCT2
         Guest* GenerateGuest();
 
         void ResetHistories();
-        void UpdateHistories();
+        void UpdateHistories(const GuestStatistics& guestStats);
 
     private:
         money64 CalculateRideValue(const Ride* ride) const;
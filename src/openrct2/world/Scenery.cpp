@@ -120,7 +120,7 @@ int32_t LargeSceneryText::MeasureHeight(std::string_view text) const
     return result;
 }
 
-void scenery_update_tile(const CoordsXY& sceneryPos)
+void scenery_update_tile(const CoordsXY& sceneryPos, TileUpdateEffects& effects)
 {
     TileElement* tileElement;
 
@@ -139,7 +139,7 @@ void scenery_update_tile(const CoordsXY& sceneryPos)
 
         if (tileElement->GetType() == TileElementType::SmallScenery)
         {
-            tileElement->AsSmallScenery()->UpdateAge(sceneryPos);
+            tileElement->AsSmallScenery()->UpdateAge(sceneryPos, effects);
         }
         else if (tileElement->GetType() == TileElementType::Path)
         {
@@ -150,11 +150,11 @@ void scenery_update_tile(const CoordsXY& sceneryPos)
                 {
                     if (pathAddEntry->flags & PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER)
                     {
-                        JumpingFountain::StartAnimation(JumpingFountainType::Water, sceneryPos, tileElement);
+                        effects.StartFountain(JumpingFountainType::Water, sceneryPos, tileElement);
                     }
                     else if (pathAddEntry->flags & PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW)
                     {
-                        JumpingFountain::StartAnimation(JumpingFountainType::Snow, sceneryPos, tileElement);
+                        effects.StartFountain(JumpingFountainType::Snow, sceneryPos, tileElement);
                     }
                 }
             }
@@ -166,7 +166,7 @@ void scenery_update_tile(const CoordsXY& sceneryPos)
  *
  *  rct2: 0x006E33D9
  */
-void SmallSceneryElement::UpdateAge(const CoordsXY& sceneryPos)
+void SmallSceneryElement::UpdateAge(const CoordsXY& sceneryPos, TileUpdateEffects& effects)
 {
     auto* sceneryEntry = GetEntry();
     if (sceneryEntry == nullptr)
@@ -181,7 +181,7 @@ void SmallSceneryElement::UpdateAge(const CoordsXY& sceneryPos)
 
     if (!sceneryEntry->HasFlag(SMALL_SCENERY_FLAG_CAN_BE_WATERED) || WeatherIsDry(gClimateCurrent.Weather) || GetAge() < 5)
     {
-        IncreaseAge(sceneryPos);
+        IncreaseAge(sceneryPos, effects);
         return;
     }
 
@@ -202,14 +202,14 @@ void SmallSceneryElement::UpdateAge(const CoordsXY& sceneryPos)
             case TileElementType::LargeScenery:
             case TileElementType::Entrance:
             case TileElementType::Path:
-                map_invalidate_tile_zoom1({ sceneryPos, tileElementAbove->GetBaseZ(), tileElementAbove->GetClearanceZ() });
-                IncreaseAge(sceneryPos);
+                effects.InvalidateTileZoom1({ sceneryPos, tileElementAbove->GetBaseZ(), tileElementAbove->GetClearanceZ() });
+                IncreaseAge(sceneryPos, effects);
                 return;
             case TileElementType::SmallScenery:
                 sceneryEntry = tileElementAbove->AsSmallScenery()->GetEntry();
                 if (sceneryEntry->HasFlag(SMALL_SCENERY_FLAG_VOFFSET_CENTRE))
                 {
-                    IncreaseAge(sceneryPos);
+                    IncreaseAge(sceneryPos, effects);
                     return;
                 }
                 break;
@@ -220,7 +220,7 @@ void SmallSceneryElement::UpdateAge(const CoordsXY& sceneryPos)
 
     // Reset age / water plant
     SetAge(0);
-    map_invalidate_tile_zoom1({ sceneryPos, GetBaseZ(), GetClearanceZ() });
+    effects.InvalidateTileZoom1({ sceneryPos, GetBaseZ(), GetClearanceZ() });
 }
 
 /**
@@ -274,7 +274,7 @@ extern const CoordsXY SceneryQuadrantOffsets[];
 extern money64 gClearSceneryCost;
 
 void init_scenery();
-void scenery_update_tile(const CoordsXY& sceneryPos);
+void scenery_update_tile(const CoordsXY& sceneryPos, TileUpdateEffects& effects);
 void scenery_set_default_placement_configuration();
 void scenery_remove_ghost_tool_placement();
 
@@ -55,7 +55,7 @@ void SmallSceneryElement::SetAge(uint8_t newAge)
     this->age = newAge;
 }
 
-void SmallSceneryElement::IncreaseAge(const CoordsXY& sceneryPos)
+void SmallSceneryElement::IncreaseAge(const CoordsXY& sceneryPos, TileUpdateEffects& effects)
 {
     if (IsGhost())
         return;
@@ -71,7 +71,7 @@ void SmallSceneryElement::IncreaseAge(const CoordsXY& sceneryPos)
 
             if (sceneryEntry->HasFlag(SMALL_SCENERY_FLAG_CAN_WITHER))
             {
-                map_invalidate_tile_zoom1({ sceneryPos, GetBaseZ(), GetClearanceZ() });
+                effects.InvalidateTileZoom1({ sceneryPos, GetBaseZ(), GetClearanceZ() });
             }
         }
     }
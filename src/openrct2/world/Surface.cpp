@@ -85,16 +85,14 @@ void SurfaceElement::SetGrassLength(uint8_t newLength)
     GrassLength = newLength;
 }
 
-void SurfaceElement::SetGrassLengthAndInvalidate(uint8_t length, const CoordsXY& coords)
+/**
+ * Whether changing the grass length changes how the tile is drawn.
+ */
+static bool GrassLengthChangeIsVisible(uint8_t oldLength, uint8_t newLength)
 {
-    uint8_t oldLength = GrassLength & 0x7;
-    uint8_t newLength = length & 0x7;
-
-    GrassLength = length;
-
     if (newLength == oldLength)
     {
-        return;
+        return false;
     }
 
     // If the new grass length won't result in an actual visual change
@@ -102,30 +100,53 @@ void SurfaceElement::SetGrassLengthAndInvalidate(uint8_t length, const CoordsXY&
     if (((oldLength > 0 && oldLength < 4) && (newLength > 0 && newLength < 4))
         || ((oldLength > 3 && oldLength < 7) && (newLength > 3 && newLength < 7)))
     {
-        return;
+        return false;
     }
+    return true;
+}
 
-    int32_t z = GetBaseZ();
-    map_invalidate_tile({ coords, z, z + 16 });
+void SurfaceElement::SetGrassLengthAndInvalidate(uint8_t length, const CoordsXY& coords)
+{
+    uint8_t oldLength = GrassLength & 0x7;
+    uint8_t newLength = length & 0x7;
+
+    GrassLength = length;
+
+    if (GrassLengthChangeIsVisible(oldLength, newLength))
+    {
+        int32_t z = GetBaseZ();
+        map_invalidate_tile({ coords, z, z + 16 });
+    }
 }
 
 /**
  *
  *  rct2: 0x006647A1
  */
-void SurfaceElement::UpdateGrassLength(const CoordsXY& coords)
+void SurfaceElement::UpdateGrassLength(const CoordsXY& coords, TileUpdateEffects& effects)
 {
     // Check if tile is grass
     if (!CanGrassGrow())
         return;
 
+    // Same as SetGrassLengthAndInvalidate() but the invalidation is left to the game thread.
+    const auto setGrassLength = [&](uint8_t length) {
+        uint8_t oldLength = GrassLength & 0x7;
+        GrassLength = length;
+        if (GrassLengthChangeIsVisible(oldLength, length & 0x7))
+        {
+            int32_t z = GetBaseZ();
+            effects.InvalidateTile({ coords, z, z + 16 });
+        }
+    };
+
     uint8_t grassLengthTmp = GrassLength & 7;
 
     // Check if grass is underwater or outside park
     if (GetWaterHeight() > GetBaseZ() || !map_is_location_in_park(coords))
     {
         if (grassLengthTmp != GRASS_LENGTH_CLEAR_0)
-            SetGrassLengthAndInvalidate(GRASS_LENGTH_CLEAR_0, coords);
+            setGrassLength(GRASS_LENGTH_CLEAR_0);
 
         return;
     }
@@ -159,14 +180,14 @@ void SurfaceElement::UpdateGrassLength(const CoordsXY& coords)
                 GrassLength ^= 8;
                 if (GrassLength & 8)
                 {
-                    // Random growth rate (length nibble)
-                    GrassLength |= scenario_rand() & 0x70;
+                    // Random growth rate (length nibble), drawn from the scenario random number generator.
+                    effects.GrowGrassRandomly(this);
                 }
                 else
                 {
                     // Increase length if not at max length
                     if (grassLengthTmp != GRASS_LENGTH_CLUMPS_2)
-                        SetGrassLengthAndInvalidate(grassLengthTmp + 1, coords);
+                        setGrassLength(grassLengthTmp + 1);
                 }
             }
         }
@@ -184,7 +205,7 @@ void SurfaceElement::UpdateGrassLength(const CoordsXY& coords)
                 continue;
 
             if (grassLengthTmp != GRASS_LENGTH_CLEAR_0)
-                SetGrassLengthAndInvalidate(GRASS_LENGTH_CLEAR_0, coords);
+                setGrassLength(GRASS_LENGTH_CLEAR_0);
         }
         break;
     }
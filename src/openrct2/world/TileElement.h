@@ -30,6 +30,7 @@ class TerrainEdgeObject;
 class FootpathObject;
 class FootpathSurfaceObject;
 class FootpathRailingsObject;
+class TileUpdateEffects;
 using track_type_t = uint16_t;
 
 constexpr const uint8_t MAX_ELEMENT_HEIGHT = 255;
@@ -215,7 +216,7 @@ public:
     uint8_t GetGrassLength() const;
     void SetGrassLength(uint8_t newLength);
     void SetGrassLengthAndInvalidate(uint8_t newLength, const CoordsXY& coords);
-    void UpdateGrassLength(const CoordsXY& coords);
+    void UpdateGrassLength(const CoordsXY& coords, TileUpdateEffects& effects);
 
     uint8_t GetOwnership() const;
     void SetOwnership(uint8_t newOwnership);
@@ -442,7 +443,7 @@ public:
     SmallSceneryEntry* GetEntry() const;
     uint8_t GetAge() const;
     void SetAge(uint8_t newAge);
-    void IncreaseAge(const CoordsXY& sceneryPos);
+    void IncreaseAge(const CoordsXY& sceneryPos, TileUpdateEffects& effects);
     uint8_t GetSceneryQuadrant() const;
     void SetSceneryQuadrant(uint8_t newQuadrant);
     colour_t GetPrimaryColour() const;
@@ -451,7 +452,7 @@ public:
     void SetSecondaryColour(colour_t colour);
     bool NeedsSupports() const;
     void SetNeedsSupports();
-    void UpdateAge(const CoordsXY& sceneryPos);
+    void UpdateAge(const CoordsXY& sceneryPos, TileUpdateEffects& effects);
 };
 assert_struct_size(SmallSceneryElement, 16);
 
@@ -163,7 +163,7 @@ namespace OpenRCT2::TileInspector
                 tileElement->RemoveBannerEntry();
             }
 
-            tile_element_remove(tileElement);
+            tile_element_remove(loc, tileElement);
             map_invalidate_tile_full(loc);
 
             if (auto* inspector = GetTileInspectorWithPos(loc); inspector != nullptr)
@@ -1043,17 +1043,29 @@ namespace OpenRCT2::TileInspector
         return GameActions::Result();
     }
 
-    // NOTE: The pointer is exclusively used to determine the  current selection,
-    // do not access the data, points to potentially invalid memory.
-    static const TileElement* _highlightedElement = nullptr;
+    // The selection is kept as the tile and the index of the element on it, elements are moved in memory when the map
+    // is compacted.
+    static CoordsXY _highlightedLoc;
+    static int32_t _highlightedIndex = -1;
 
-    void SetSelectedElement(const TileElement* elem)
+    void SetSelectedElement(const CoordsXY& loc, const TileElement* elem)
     {
-        _highlightedElement = elem;
+        const auto* first = elem != nullptr ? map_get_first_element_at(loc) : nullptr;
+        _highlightedLoc = loc;
+        _highlightedIndex = first != nullptr ? static_cast<int32_t>(elem - first) : -1;
     }
 
     bool IsElementSelected(const TileElement* elem)
     {
-        return _highlightedElement == elem;
+        if (_highlightedIndex < 0)
+            return false;
+
+        const auto* element = map_get_first_element_at(_highlightedLoc);
+        for (int32_t i = 0; element != nullptr && i < _highlightedIndex; i++)
+        {
+            if ((element++)->IsLastForTile())
+                return false;
+        }
+        return element == elem;
     }
 } // namespace OpenRCT2::TileInspector
@@ -19,7 +19,7 @@ namespace GameActions
 
 namespace OpenRCT2::TileInspector
 {
-    void SetSelectedElement(const TileElement* elem);
+    void SetSelectedElement(const CoordsXY& loc, const TileElement* elem);
     bool IsElementSelected(const TileElement* elem);
 
     GameActions::Result InsertCorruptElementAt(const CoordsXY& loc, int16_t elementIndex, bool isExecuting);
@@ -11,22 +11,44 @@
 
 #include "Location.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
 #include <vector>
 
+/**
+ * Maps every tile to the first of its elements, the elements of a tile are a contiguous run ending with the element
+ * flagged as last for the tile. A 32-bit offset into the element array is stored per tile instead of a pointer which
+ * halves the size of the index. Tiles may still be pointed at elements outside of the array (or nothing), those few
+ * are kept in a separate list.
+ */
 template<typename T> class TilePointerIndex
 {
-    std::vector<T*> TilePointers;
+    static constexpr uint32_t ExternalTile = std::numeric_limits<uint32_t>::max();
+
+    T* Elements{};
+    size_t Capacity{};
+    std::vector<uint32_t> TileOffsets;
+    std::vector<std::pair<size_t, T*>> ExternalTiles;
     uint16_t MapSize{};
 
 public:
     TilePointerIndex() = default;
 
-    explicit TilePointerIndex(const uint16_t mapSize, T* tileElements, size_t count)
+    /**
+     * Builds the index from count elements laid out tile by tile, capacity is the number of elements the array can
+     * hold without being reallocated. Runs added later within the capacity are stored as offsets as well.
+     */
+    explicit TilePointerIndex(const uint16_t mapSize, T* tileElements, size_t count, size_t capacity = 0)
     {
         MapSize = mapSize;
-        TilePointers.reserve(MapSize * MapSize);
+        Elements = tileElements;
+        Capacity = std::max(count, capacity);
+        assert(Capacity < ExternalTile);
+        TileOffsets.reserve(MapSize * MapSize);
 
         size_t index = 0;
         for (size_t y = 0; y < MapSize; y++)
@@ -34,7 +56,7 @@ public:
             for (size_t x = 0; x < MapSize; x++)
             {
                 assert(index < count);
-                TilePointers.emplace_back(&tileElements[index]);
+                TileOffsets.emplace_back(static_cast<uint32_t>(index));
                 do
                 {
                     index++;
@@ -45,11 +67,67 @@ public:
 
     T* GetFirstElementAt(TileCoordsXY coords)
     {
-        return TilePointers[coords.x + (coords.y * MapSize)];
+        const size_t tileIndex = coords.x + (coords.y * MapSize);
+        const uint32_t offset = TileOffsets[tileIndex];
+        if (offset != ExternalTile)
+            return Elements + offset;
+        return GetExternalTile(tileIndex);
+    }
+
+    /**
+     * Returns the offset of the first element of the tile, or nothing if the tile points outside of the element array.
+     */
+    std::optional<uint32_t> GetTileOffset(TileCoordsXY coords) const
+    {
+        const uint32_t offset = TileOffsets[coords.x + (coords.y * MapSize)];
+        if (offset == ExternalTile)
+            return std::nullopt;
+        return offset;
+    }
+
+    /**
+     * Points the index at the new location of the element array after it has been reallocated.
+     */
+    void SetElements(T* tileElements, size_t capacity)
+    {
+        assert(capacity < ExternalTile);
+        Elements = tileElements;
+        Capacity = capacity;
     }
 
     void SetTile(TileCoordsXY coords, T* tileElement)
     {
-        TilePointers[coords.x + (coords.y * MapSize)] = tileElement;
+        const size_t tileIndex = coords.x + (coords.y * MapSize);
+        if (TileOffsets[tileIndex] == ExternalTile)
+        {
+            RemoveExternalTile(tileIndex);
+        }
+
+        if (tileElement != nullptr && tileElement >= Elements && tileElement < Elements + Capacity)
+        {
+            TileOffsets[tileIndex] = static_cast<uint32_t>(tileElement - Elements);
+        }
+        else
+        {
+            TileOffsets[tileIndex] = ExternalTile;
+            ExternalTiles.emplace_back(tileIndex, tileElement);
+        }
+    }
+
+private:
+    T* GetExternalTile(size_t tileIndex) const
+    {
+        for (const auto& [index, tileElement] : ExternalTiles)
+        {
+            if (index == tileIndex)
+                return tileElement;
+        }
+        return nullptr;
+    }
+
+    void RemoveExternalTile(size_t tileIndex)
+    {
+        auto isTile = [tileIndex](const auto& entry) { return entry.first == tileIndex; };
+        ExternalTiles.erase(std::remove_if(ExternalTiles.begin(), ExternalTiles.end(), isTile), ExternalTiles.end());
     }
 };
@@ -0,0 +1,96 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <openrct2/core/ChecksumStream.h>
+#include <openrct2/util/Util.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class ChecksumStreamTests : public testing::Test
+{
+protected:
+    static std::vector<std::byte> CreateData(size_t length)
+    {
+        std::mt19937 rng(12345);
+        std::vector<std::byte> data(length);
+        std::generate(data.begin(), data.end(), [&rng]() { return static_cast<std::byte>(rng()); });
+        return data;
+    }
+
+    static std::array<std::byte, 20> Hash(const std::vector<std::byte>& data)
+    {
+        std::array<std::byte, 20> checksum{};
+        ChecksumStream stream(checksum, ChecksumAlgorithm::MultiLane);
+        stream.Write(data.data(), data.size());
+        stream.Finish();
+        return checksum;
+    }
+
+    static void SwapStripes(std::vector<std::byte>& data, size_t a, size_t b)
+    {
+        std::swap_ranges(
+            data.begin() + a * ChecksumStream::StripeSize, data.begin() + (a + 1) * ChecksumStream::StripeSize,
+            data.begin() + b * ChecksumStream::StripeSize);
+    }
+};
+
+TEST_F(ChecksumStreamTests, scalar_and_avx2_match)
+{
+    if (!avx2_available())
+        return;
+
+    constexpr size_t numStripes = 37;
+    const auto data = CreateData(numStripes * ChecksumStream::StripeSize);
+    for (uint64_t firstStripe : { 0ULL, 1ULL, 1000ULL, 0xFFFFFFFFFFFFFFF0ULL })
+    {
+        std::array<uint64_t, ChecksumStream::NumLanes> scalarLanes = { 1, 2, 3, 4 };
+        std::array<uint64_t, ChecksumStream::NumLanes> avx2Lanes = scalarLanes;
+        checksum_accumulate_scalar(scalarLanes.data(), data.data(), numStripes, firstStripe);
+        checksum_accumulate_avx2(avx2Lanes.data(), data.data(), numStripes, firstStripe);
+        ASSERT_EQ(scalarLanes, avx2Lanes);
+    }
+}
+
+TEST_F(ChecksumStreamTests, swapped_stripes_change_hash)
+{
+    const auto data = CreateData(64 * ChecksumStream::StripeSize + 5);
+    const auto expected = Hash(data);
+
+    // Neighbouring stripes and stripes in different blocks.
+    for (auto [a, b] : { std::pair<size_t, size_t>{ 0, 1 }, { 3, 40 }, { 16, 63 } })
+    {
+        auto swapped = data;
+        SwapStripes(swapped, a, b);
+        ASSERT_NE(Hash(swapped), expected);
+    }
+}
+
+TEST_F(ChecksumStreamTests, split_writes_match_single_write)
+{
+    const auto data = CreateData(3000);
+    const auto expected = Hash(data);
+
+    std::array<std::byte, 20> checksum{};
+    ChecksumStream stream(checksum, ChecksumAlgorithm::MultiLane);
+    size_t offset = 0;
+    for (size_t length = 1; offset < data.size(); length = (length * 3) % 700 + 1)
+    {
+        length = std::min(length, data.size() - offset);
+        stream.Write(data.data() + offset, length);
+        offset += length;
+    }
+    stream.Finish();
+    ASSERT_EQ(checksum, expected);
+}
@@ -0,0 +1,123 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/core/JobPool.h>
+#include <thread>
+#include <vector>
+
+TEST(JobPoolTests, parallel_for_visits_every_index_once)
+{
+    for (size_t count : { 1, 7, 1000, 12345 })
+    {
+        for (size_t grainSize : { 0, 1, 3, 64, 100000 })
+        {
+            std::vector<std::atomic<int>> visits(count);
+            JobPool pool;
+            pool.ParallelFor(count, [&visits](size_t i) { visits[i]++; }, grainSize);
+            for (size_t i = 0; i < count; i++)
+            {
+                ASSERT_EQ(visits[i], 1) << "count " << count << ", grain size " << grainSize << ", index " << i;
+            }
+        }
+    }
+
+    JobPool pool;
+    pool.ParallelFor(0, [](size_t) { FAIL(); });
+}
+
+TEST(JobPoolTests, nested_parallel_for)
+{
+    // More outer tasks than workers, so every worker blocks in a nested Join() at some point.
+    const size_t outerCount = JobPool::GetWorkerCount() * 4;
+    constexpr size_t innerCount = 500;
+    std::atomic<size_t> total = 0;
+
+    JobPool pool;
+    pool.ParallelFor(
+        outerCount,
+        [&total](size_t) {
+            JobPool inner;
+            inner.ParallelFor(innerCount, [&total](size_t) { total++; }, 1);
+        },
+        1);
+    ASSERT_EQ(total, outerCount * innerCount);
+}
+
+TEST(JobPoolTests, tasks_add_tasks_to_their_pool)
+{
+    std::atomic<size_t> total = 0;
+    JobPool pool;
+
+    // Every task adds two more until the depth is reached, 2^11 - 1 tasks in total.
+    std::function<void(int)> spawn = [&](int depth) {
+        total++;
+        if (depth > 0)
+        {
+            pool.AddTask([&spawn, depth]() { spawn(depth - 1); });
+            pool.AddTask([&spawn, depth]() { spawn(depth - 1); });
+        }
+    };
+    pool.AddTask([&spawn]() { spawn(10); });
+    pool.Join();
+    ASSERT_EQ(total, 2047u);
+    ASSERT_EQ(pool.CountPending(), 0u);
+}
+
+TEST(JobPoolTests, join_waits_for_stolen_tasks)
+{
+    constexpr size_t numTasks = 64;
+    std::atomic<size_t> finished = 0;
+    std::atomic<size_t> completed = 0;
+    const auto joinThread = std::this_thread::get_id();
+
+    JobPool pool;
+    for (size_t i = 0; i < numTasks; i++)
+    {
+        pool.AddTask(
+            [&finished]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                finished++;
+            },
+            [&completed, joinThread]() {
+                EXPECT_EQ(std::this_thread::get_id(), joinThread);
+                completed++;
+            });
+    }
+    pool.Join();
+    ASSERT_EQ(finished, numTasks);
+    ASSERT_EQ(completed, numTasks);
+}
+
+TEST(JobPoolTests, destroying_pool_waits_for_queued_tasks)
+{
+    constexpr size_t numTasks = 256;
+    auto finished = std::make_shared<std::atomic<size_t>>(0);
+    std::atomic<size_t> completed = 0;
+    {
+        JobPool pool;
+        for (size_t i = 0; i < numTasks; i++)
+        {
+            pool.AddTask(
+                [finished]() {
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                    (*finished)++;
+                },
+                [&completed]() { completed++; });
+        }
+    }
+    ASSERT_EQ(*finished, numTasks);
+    ASSERT_EQ(completed, numTasks);
+
+    // Only the test holds the counter once every task has been destroyed.
+    ASSERT_EQ(finished.use_count(), 1);
+}
@@ -0,0 +1,114 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <openrct2/network/NetworkMapDelta.h>
+#include <random>
+#include <vector>
+
+class NetworkMapDeltaTests : public testing::Test
+{
+protected:
+    static std::vector<uint8_t> CreateMap(size_t length, uint32_t seed = 12345)
+    {
+        std::mt19937 rng(seed);
+        std::vector<uint8_t> data(length);
+        std::generate(data.begin(), data.end(), [&rng]() { return static_cast<uint8_t>(rng()); });
+        return data;
+    }
+
+    static std::vector<uint8_t> RoundTrip(const std::vector<uint8_t>& base, const std::vector<uint8_t>& target)
+    {
+        auto delta = NetworkMapDelta::Encode(base, target);
+        return NetworkMapDelta::Decode(base, delta.data(), delta.size());
+    }
+
+    static std::vector<uint8_t> CreateCopy(uint32_t targetSize, uint32_t baseOffset, uint32_t length)
+    {
+        std::vector<uint8_t> delta(13);
+        std::memcpy(&delta[0], &targetSize, sizeof(targetSize));
+        delta[4] = 0; // Copy
+        std::memcpy(&delta[5], &baseOffset, sizeof(baseOffset));
+        std::memcpy(&delta[9], &length, sizeof(length));
+        return delta;
+    }
+};
+
+TEST_F(NetworkMapDeltaTests, identical_map_is_copied)
+{
+    const auto base = CreateMap(100000);
+    const auto delta = NetworkMapDelta::Encode(base, base);
+    ASSERT_LT(delta.size(), 64u);
+    ASSERT_EQ(NetworkMapDelta::Decode(base, delta.data(), delta.size()), base);
+}
+
+TEST_F(NetworkMapDeltaTests, changed_byte)
+{
+    const auto base = CreateMap(100000);
+    for (size_t offset : { size_t{ 0 }, size_t{ 63 }, size_t{ 50000 }, base.size() - 1 })
+    {
+        auto target = base;
+        target[offset] ^= 0xFF;
+        const auto delta = NetworkMapDelta::Encode(base, target);
+        ASSERT_LT(delta.size(), 256u);
+        ASSERT_EQ(NetworkMapDelta::Decode(base, delta.data(), delta.size()), target);
+    }
+}
+
+TEST_F(NetworkMapDeltaTests, resized_map)
+{
+    const auto base = CreateMap(100000);
+
+    auto grown = base;
+    const auto inserted = CreateMap(5000, 1);
+    grown.insert(grown.begin() + 30000, inserted.begin(), inserted.end());
+    ASSERT_EQ(RoundTrip(base, grown), grown);
+
+    auto shrunk = base;
+    shrunk.erase(shrunk.begin() + 20000, shrunk.begin() + 27000);
+    ASSERT_EQ(RoundTrip(base, shrunk), shrunk);
+
+    ASSERT_EQ(RoundTrip(base, {}), std::vector<uint8_t>());
+    ASSERT_EQ(RoundTrip({}, base), base);
+    ASSERT_EQ(RoundTrip(base, CreateMap(10)), CreateMap(10));
+}
+
+TEST_F(NetworkMapDeltaTests, copy_out_of_range_throws)
+{
+    const auto base = CreateMap(1000);
+    const auto delta = CreateCopy(100, 950, 100);
+    ASSERT_THROW(NetworkMapDelta::Decode(base, delta.data(), delta.size()), std::exception);
+
+    const auto overflow = CreateCopy(100, 0xFFFFFFF0, 0x20);
+    ASSERT_THROW(NetworkMapDelta::Decode(base, overflow.data(), overflow.size()), std::exception);
+}
+
+TEST_F(NetworkMapDeltaTests, corrupt_delta_throws)
+{
+    const auto base = CreateMap(100000);
+    auto target = base;
+    target[50000] ^= 0xFF;
+    const auto delta = NetworkMapDelta::Encode(base, target);
+
+    // Every truncation of the delta is rejected.
+    for (size_t length = 0; length < delta.size(); length++)
+    {
+        ASSERT_THROW(NetworkMapDelta::Decode(base, delta.data(), length), std::exception) << "length " << length;
+    }
+
+    auto unknownOp = delta;
+    unknownOp[4] = 7;
+    ASSERT_THROW(NetworkMapDelta::Decode(base, unknownOp.data(), unknownOp.size()), std::exception);
+
+    auto wrongSize = delta;
+    wrongSize[0]++;
+    ASSERT_THROW(NetworkMapDelta::Decode(base, wrongSize.data(), wrongSize.size()), std::exception);
+}
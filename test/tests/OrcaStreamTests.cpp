@@ -0,0 +1,196 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <map>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/core/OrcaStream.hpp>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class OrcaStreamTests : public testing::Test
+{
+protected:
+    using Chunks = std::map<uint32_t, std::vector<uint8_t>>;
+
+    // Offsets in the file written by OrcaStream, see OrcaStream::Header.
+    static constexpr size_t HeaderSize = 64;
+    static constexpr size_t CompressionOffset = 24;
+    static constexpr size_t ChunkEntrySize = 20;
+    static constexpr size_t BlockSize = 16;
+
+    static std::vector<uint8_t> CreateData(size_t length, uint32_t seed)
+    {
+        // Half random and half repeated, so the data is compressible but not trivially.
+        std::mt19937 rng(seed);
+        std::vector<uint8_t> data(length);
+        for (size_t i = 0; i < length; i++)
+        {
+            data[i] = (i / 256) % 2 == 0 ? static_cast<uint8_t>(rng()) : static_cast<uint8_t>(i);
+        }
+        return data;
+    }
+
+    static Chunks CreateChunks()
+    {
+        return {
+            { 1, CreateData(10, 1) },
+            { 2, {} },
+            { 3, CreateData(3 * OrcaStream::CompressionBlockSize + 5, 3) },
+            { 4, CreateData(OrcaStream::CompressionBlockSize, 4) },
+        };
+    }
+
+    static std::vector<uint8_t> Write(const Chunks& chunks, uint32_t compression = OrcaStream::COMPRESSION_GZIP_CHUNKS)
+    {
+        MemoryStream ms;
+        {
+            OrcaStream os(ms, OrcaStream::Mode::WRITING);
+            os.GetHeader().Compression = compression;
+            for (const auto& [id, data] : chunks)
+            {
+                os.ReadWriteChunk(id, [&data = data](OrcaStream::ChunkStream& cs) { cs.Write(data.data(), data.size()); });
+            }
+        }
+        const auto* data = static_cast<const uint8_t*>(ms.GetData());
+        return std::vector<uint8_t>(data, data + ms.GetLength());
+    }
+
+    static std::vector<uint8_t> ReadChunk(OrcaStream& os, uint32_t id, size_t length)
+    {
+        std::vector<uint8_t> result(length);
+        bool found = os.ReadWriteChunk(id, [&result](OrcaStream::ChunkStream& cs) { cs.Read(result.data(), result.size()); });
+        EXPECT_TRUE(found);
+        return result;
+    }
+
+    static Chunks ReadAll(const std::vector<uint8_t>& file, const Chunks& expected)
+    {
+        MemoryStream ms(file.data(), file.size());
+        OrcaStream os(ms, OrcaStream::Mode::READING);
+        Chunks result;
+        for (auto it = expected.rbegin(); it != expected.rend(); it++)
+        {
+            result[it->first] = ReadChunk(os, it->first, it->second.size());
+        }
+        return result;
+    }
+
+    static size_t BlockTableOffset(const Chunks& chunks)
+    {
+        return HeaderSize + chunks.size() * ChunkEntrySize;
+    }
+};
+
+TEST_F(OrcaStreamTests, gzip_chunks_round_trip)
+{
+    const auto chunks = CreateChunks();
+    const auto file = Write(chunks);
+
+    uint32_t compression{};
+    std::memcpy(&compression, &file[CompressionOffset], sizeof(compression));
+    ASSERT_EQ(compression, OrcaStream::COMPRESSION_GZIP_CHUNKS);
+
+    // One block for the small chunk, four and one for the large ones and none for the empty chunk.
+    uint32_t numBlocks{};
+    std::memcpy(&numBlocks, &file[BlockTableOffset(chunks)], sizeof(numBlocks));
+    ASSERT_EQ(numBlocks, 6u);
+
+    ASSERT_EQ(ReadAll(file, chunks), chunks);
+}
+
+TEST_F(OrcaStreamTests, gzip_round_trip)
+{
+    const auto chunks = CreateChunks();
+    ASSERT_EQ(ReadAll(Write(chunks, OrcaStream::COMPRESSION_GZIP), chunks), chunks);
+    ASSERT_EQ(ReadAll(Write(chunks, OrcaStream::COMPRESSION_NONE), chunks), chunks);
+}
+
+TEST_F(OrcaStreamTests, single_chunk_matches_full_read)
+{
+    const auto chunks = CreateChunks();
+    const auto file = Write(chunks);
+    const auto all = ReadAll(file, chunks);
+
+    // Only the requested chunk is decompressed, in any order and as often as it is requested.
+    for (const auto& [id, data] : chunks)
+    {
+        MemoryStream ms(file.data(), file.size());
+        OrcaStream os(ms, OrcaStream::Mode::READING);
+        ASSERT_EQ(ReadChunk(os, id, data.size()), all.at(id));
+        ASSERT_EQ(ReadChunk(os, id, data.size()), all.at(id));
+    }
+
+    // A corrupt block only fails the chunk it belongs to.
+    auto corrupt = file;
+    corrupt[file.size() / 2] ^= 0xFF;
+    MemoryStream ms(corrupt.data(), corrupt.size());
+    OrcaStream os(ms, OrcaStream::Mode::READING);
+    ASSERT_EQ(ReadChunk(os, 1, chunks.at(1).size()), all.at(1));
+    ASSERT_EQ(ReadChunk(os, 4, chunks.at(4).size()), all.at(4));
+    ASSERT_ANY_THROW(ReadChunk(os, 3, chunks.at(3).size()));
+}
+
+TEST_F(OrcaStreamTests, missing_chunk)
+{
+    const auto file = Write(CreateChunks());
+    MemoryStream ms(file.data(), file.size());
+    OrcaStream os(ms, OrcaStream::Mode::READING);
+    ASSERT_FALSE(os.ReadWriteChunk(5, [](OrcaStream::ChunkStream&) {}));
+}
+
+TEST_F(OrcaStreamTests, truncated_file_throws)
+{
+    const auto chunks = CreateChunks();
+    const auto file = Write(chunks);
+    const auto tableOffset = BlockTableOffset(chunks);
+    for (size_t length : { size_t{ 0 }, HeaderSize - 1, tableOffset + 2, tableOffset + 4 + BlockSize + 3, file.size() / 2,
+                           file.size() - 1 })
+    {
+        auto truncated = std::vector<uint8_t>(file.begin(), file.begin() + length);
+        ASSERT_ANY_THROW(ReadAll(truncated, chunks)) << "length " << length;
+    }
+}
+
+TEST_F(OrcaStreamTests, corrupt_block_table_throws)
+{
+    const auto chunks = CreateChunks();
+    const auto file = Write(chunks);
+    const auto tableOffset = BlockTableOffset(chunks);
+    const auto firstBlock = tableOffset + sizeof(uint32_t);
+
+    // Corrupts a value in the file and expects reading to fail.
+    auto expectThrow = [&](size_t offset, auto value) {
+        auto corrupt = file;
+        std::memcpy(&corrupt[offset], &value, sizeof(value));
+        ASSERT_ANY_THROW(ReadAll(corrupt, chunks)) << "offset " << offset;
+    };
+
+    // Number of blocks
+    expectThrow(tableOffset, uint32_t{ 0xFFFFFFFF });
+    expectThrow(tableOffset, uint32_t{ 5 });
+    expectThrow(tableOffset, uint32_t{ 0 });
+    // Uncompressed offset, out of range, overflowing and out of order
+    expectThrow(firstBlock, uint64_t{ 0x7FFFFFFF });
+    expectThrow(firstBlock, uint64_t{ 0xFFFFFFFFFFFFFFFF });
+    expectThrow(firstBlock + BlockSize, uint64_t{ 0 });
+    // Uncompressed and compressed length
+    expectThrow(firstBlock + 8, uint32_t{ 11 });
+    expectThrow(firstBlock + 12, uint32_t{ 0xFFFFFFFF });
+    expectThrow(firstBlock + 12, uint32_t{ 1 });
+
+    // Compressed data of the large chunk
+    auto corrupt = file;
+    corrupt[file.size() / 2] ^= 0xFF;
+    ASSERT_ANY_THROW(ReadAll(corrupt, chunks));
+}
@@ -8,8 +8,10 @@
 #include <gtest/gtest.h>
 #include <openrct2/Context.h>
 #include <openrct2/Game.h>
+#include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ParkImporter.h>
+#include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/platform/platform.h>
 #include <openrct2/world/Footpath.h>
 #include <openrct2/world/Map.h>
@@ -251,3 +253,50 @@ INSTANTIATE_TEST_CASE_P(
         SimplePathfindingScenario("PathWithFences", { 11, 6, 14 }, 10000),
         SimplePathfindingScenario("PathWithCliff", { 7, 17, 14 }, 10000)),
     SimplePathfindingScenario::ToName);
+
+// Plays a park and returns the checksum of all entities every 100 ticks.
+static std::vector<std::string> PlayPark(const char* parkName, bool useDirectionCache)
+{
+    std::vector<std::string> checksums;
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    EXPECT_TRUE(initialised);
+    if (!initialised)
+        return checksums;
+
+    load_from_sv6(TestData::GetParkPath(parkName).c_str());
+    game_load_init();
+    FootpathGraph::SetDirectionCacheEnabled(useDirectionCache);
+
+    auto* gameState = context->GetGameState();
+    for (int32_t tick = 1; tick <= 2000; tick++)
+    {
+        gameState->UpdateLogic();
+        if (tick % 100 == 0)
+        {
+            checksums.push_back(GetAllEntitiesChecksum().ToString());
+        }
+    }
+    FootpathGraph::SetDirectionCacheEnabled(true);
+    return checksums;
+}
+
+TEST(PathfindingDirectionCache, SameGameWithoutCache)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    core_init();
+
+    const auto uncached = PlayPark("bpb.sv6", false);
+    const auto statsBefore = FootpathGraph::GetDirectionCacheStats();
+    const auto cached = PlayPark("bpb.sv6", true);
+    const auto statsAfter = FootpathGraph::GetDirectionCacheStats();
+
+    // The cache has to be used for the comparison to mean anything.
+    ASSERT_GT(statsAfter.Hits, statsBefore.Hits);
+    ASSERT_EQ(cached.size(), uncached.size());
+    for (size_t i = 0; i < cached.size(); i++)
+    {
+        ASSERT_EQ(cached[i], uncached[i]) << "after " << (i + 1) * 100 << " ticks";
+    }
+}
@@ -17,6 +17,7 @@
 #include <openrct2/ParkImporter.h>
 #include <openrct2/actions/ParkSetParameterAction.h>
 #include <openrct2/actions/RideSetPriceAction.h>
+#include <openrct2/entity/EntityList.h>
 #include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/entity/EntityTweener.h>
 #include <openrct2/entity/Peep.h>
@@ -26,7 +27,9 @@
 #include <openrct2/world/MapAnimation.h>
 #include <openrct2/world/Park.h>
 #include <openrct2/world/Scenery.h>
+#include <limits>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -193,3 +196,41 @@ TEST_F(PlayTests, CarRideWithOneCarOnlyAcceptsTwoGuests)
         gs->UpdateLogic();
     }
 }
+
+// Plays a park and returns the checksum of all entities every 100 ticks.
+static std::vector<std::string> playPark(const std::string& parkPath, size_t guestTimerParallelThreshold)
+{
+    std::vector<std::string> checksums;
+    auto context = localStartGame(parkPath);
+    EXPECT_NE(context.get(), nullptr);
+    if (context == nullptr)
+        return checksums;
+
+    EXPECT_GT(GetEntityListCount(EntityType::Guest), 0u);
+    gGuestTimerParallelThreshold = guestTimerParallelThreshold;
+    auto gs = context->GetGameState();
+    for (int tick = 1; tick <= 2000; tick++)
+    {
+        gs->UpdateLogic();
+        if (tick % 100 == 0)
+        {
+            checksums.push_back(GetAllEntitiesChecksum().ToString());
+        }
+    }
+    gGuestTimerParallelThreshold = 2048;
+    return checksums;
+}
+
+TEST_F(PlayTests, PreparedGuestTimersPlayTheSameGame)
+{
+    // The guest timers are always prepared on the job pool in one run and never in the other.
+    std::string initStateFile = TestData::GetParkPath("bpb.sv6");
+    const auto serial = playPark(initStateFile, std::numeric_limits<size_t>::max());
+    const auto prepared = playPark(initStateFile, 0);
+
+    ASSERT_EQ(prepared.size(), serial.size());
+    for (size_t i = 0; i < prepared.size(); i++)
+    {
+        ASSERT_EQ(prepared[i], serial[i]) << "after " << (i + 1) * 100 << " ticks";
+    }
+}
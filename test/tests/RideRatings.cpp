@@ -20,6 +20,7 @@
 #include <openrct2/platform/platform.h>
 #include <openrct2/ride/Ride.h>
 #include <openrct2/ride/RideData.h>
+#include <openrct2/ride/RideRatings.h>
 #include <string>
 
 using namespace OpenRCT2;
@@ -88,3 +89,41 @@ TEST_F(RideRatings, all)
         expI++;
     }
 }
+
+TEST_F(RideRatings, allInstant)
+{
+    std::string path = TestData::GetParkPath("bpb.sv6");
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    load_from_sv6(path.c_str());
+
+    // Check ride count to check load was successful
+    ASSERT_EQ(ride_get_count(), 134);
+
+    ride_ratings_update_all_instant();
+
+    // Load expected ratings
+    auto expectedDataPath = Path::Combine(TestData::GetBasePath(), "ratings", "bpb.sv6.txt");
+    auto expectedRatings = File::ReadAllLines(expectedDataPath);
+
+    // Check ride ratings, rides with fixed ratings are left alone
+    int expI = 0;
+    for (const auto& ride : GetRideManager())
+    {
+        if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_FIXED_RATINGS))
+        {
+            auto actual = FormatRatings(ride);
+            auto expected = expectedRatings[expI];
+            ASSERT_STREQ(actual.c_str(), expected.c_str());
+        }
+
+        expI++;
+    }
+}
@@ -14,8 +14,14 @@
 #include <openrct2/Game.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ParkImporter.h>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/ride/TrackDesign.h>
 #include <openrct2/world/Footpath.h>
 #include <openrct2/world/Map.h>
+#include <openrct2/world/TileInspector.h>
+
+#include <cstring>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -171,3 +177,143 @@ TEST_F(TileElementWantsFootpathConnection, MapEdge)
     // The tile in the -X direction is a normal tile and should not be marked as an edge
     EXPECT_FALSE(edges & (1 << 2));
 }
+
+class TileElementCompaction : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::string parkPath = TestData::GetParkPath("tile-element-tests.sv6");
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        load_from_sv6(parkPath.c_str());
+        game_load_init();
+    }
+
+    void TearDown() override
+    {
+        _context.reset();
+    }
+
+    static std::vector<TileElement> GetElementsOnTile(const TileCoordsXY& loc)
+    {
+        std::vector<TileElement> elements;
+        const auto* element = map_get_first_element_at(loc);
+        do
+        {
+            elements.push_back(*element);
+        } while (!(element++)->IsLastForTile());
+        return elements;
+    }
+
+    // Grows and shrinks every tile again, this leaves enough unused elements behind for a compaction to start.
+    static void FragmentTileElements()
+    {
+        constexpr uint8_t markerHeight = 254;
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                auto loc = TileCoordsXYZ{ x, y, markerHeight }.ToCoordsXYZ();
+                ASSERT_NE(tile_element_insert(loc, 0, TileElementType::Wall), nullptr);
+            }
+        }
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                auto* element = map_get_first_element_at(TileCoordsXY{ x, y });
+                while (element->GetType() != TileElementType::Wall || element->base_height != markerHeight)
+                {
+                    ASSERT_FALSE(element->IsLastForTile());
+                    element++;
+                }
+                tile_element_remove(element);
+            }
+        }
+    }
+
+    static void CompactTileElements()
+    {
+        const auto sizeBefore = GetTileElements().size();
+        for (int32_t tick = 0; tick < 1000; tick++)
+        {
+            MapCompactTileElements();
+        }
+        EXPECT_LT(GetTileElements().size(), sizeBefore);
+    }
+
+private:
+    std::shared_ptr<IContext> _context;
+};
+
+TEST_F(TileElementCompaction, ElementsStayOnTheirTiles)
+{
+    ASSERT_NO_FATAL_FAILURE(FragmentTileElements());
+
+    std::vector<std::vector<TileElement>> expectedElements;
+    for (int32_t y = 0; y < gMapSize; y++)
+    {
+        for (int32_t x = 0; x < gMapSize; x++)
+        {
+            expectedElements.push_back(GetElementsOnTile({ x, y }));
+        }
+    }
+
+    // Select the footpath on a tile in the tile inspector
+    const CoordsXY selectedLoc = TileCoordsXY{ 19, 18 }.ToCoordsXY();
+    const auto* selectedElement = map_get_footpath_element(TileCoordsXYZ{ 19, 18, 14 }.ToCoordsXYZ());
+    ASSERT_NE(selectedElement, nullptr);
+    const auto selectedIndex = selectedElement - map_get_first_element_at(selectedLoc);
+    TileInspector::SetSelectedElement(selectedLoc, selectedElement);
+
+    CompactTileElements();
+
+    size_t tileIndex = 0;
+    for (int32_t y = 0; y < gMapSize; y++)
+    {
+        for (int32_t x = 0; x < gMapSize; x++)
+        {
+            const auto& expected = expectedElements[tileIndex++];
+            const auto actual = GetElementsOnTile({ x, y });
+            ASSERT_EQ(actual.size(), expected.size());
+            ASSERT_EQ(std::memcmp(actual.data(), expected.data(), actual.size() * sizeof(TileElement)), 0);
+        }
+    }
+
+    // The selection follows the element to its new position
+    EXPECT_TRUE(TileInspector::IsElementSelected(map_get_first_element_at(selectedLoc) + selectedIndex));
+    TileInspector::SetSelectedElement(selectedLoc, nullptr);
+}
+
+TEST_F(TileElementCompaction, TrackDesignSceneryFollowsElements)
+{
+    ASSERT_NO_FATAL_FAILURE(FragmentTileElements());
+
+    // Select the footpath on a tile as scenery of a track design
+    const CoordsXY pathLoc = TileCoordsXY{ 19, 18 }.ToCoordsXY();
+    auto* pathElement = map_get_footpath_element(TileCoordsXYZ{ 19, 18, 14 }.ToCoordsXYZ());
+    ASSERT_NE(pathElement, nullptr);
+    const auto pathIndex = pathElement - map_get_first_element_at(pathLoc);
+    track_design_save_init();
+    track_design_save_select_tile_element(ViewportInteractionItem::Footpath, pathLoc, pathElement, true);
+    ASSERT_TRUE(track_design_save_contains_tile_element(pathLoc, pathElement));
+
+    CompactTileElements();
+
+    // Only the footpath is still selected, not the surface below it
+    auto* firstElement = map_get_first_element_at(pathLoc);
+    EXPECT_TRUE(track_design_save_contains_tile_element(pathLoc, firstElement + pathIndex));
+    EXPECT_FALSE(track_design_save_contains_tile_element(pathLoc, firstElement));
+    EXPECT_FALSE(track_design_save_contains_tile_element(
+        TileCoordsXY{ 18, 18 }.ToCoordsXY(), map_get_first_element_at(TileCoordsXY{ 18, 18 })));
+
+    // Deselecting removes it again
+    track_design_save_select_tile_element(ViewportInteractionItem::Footpath, pathLoc, firstElement + pathIndex, false);
+    EXPECT_FALSE(track_design_save_contains_tile_element(pathLoc, firstElement + pathIndex));
+    track_design_save_init();
+}